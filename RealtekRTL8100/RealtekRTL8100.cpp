@@ -23,10 +23,71 @@
 
 #pragma mark --- function prototypes ---
 
-static inline UInt32 adjustIPv6Header(mbuf_t m);
+static inline UInt32 adjustIPv6Header(mbuf_t m, RtlHdrInfo *hdrInfo);
+static inline const UInt8 *hdrPtr(mbuf_t m, UInt32 offset, UInt32 len, UInt8 *buf);
+static inline bool txInlineVlan(mbuf_t m);
+static bool parseHeaders(mbuf_t m, RtlHdrInfo *hdrInfo);
+static bool txSoftwareChecksum(mbuf_t m, RtlHdrInfo *hdrInfo, mbuf_csum_request_flags_t checksums);
+static UInt32 rxSoftwareChecksum(mbuf_t m);
 
 static inline u32 ether_crc(int length, unsigned char *data);
 
+static inline UInt16 ipHeaderChecksum(struct ip *ipHdr);
+static UInt32 csumPartial(const UInt8 *data, UInt32 len, UInt32 sum);
+static inline UInt16 csumFold(UInt32 sum);
+static UInt32 csumMbuf(mbuf_t m, UInt32 offset, UInt32 len, UInt32 sum);
+static inline UInt32 txFreeDesc(UInt32 nextIndex, UInt32 dirtyIndex, UInt32 numDesc);
+static inline bool txHighPriority(mbuf_t m);
+static inline UInt64 mcTableKey(const UInt8 *addr);
+static inline UInt32 mcTableHash(UInt64 key);
+static void mcTableInsert(UInt64 *table, const UInt8 *addr);
+static inline bool mcTableLookup(const UInt64 *table, const UInt8 *addr);
+static inline void txQueueSample(RtlTxQueueStats *stats, UInt32 used);
+static UInt32 intrModSelectProfile(RtlIntrModState *state, UInt64 rxPackets, UInt64 rxBytes, UInt64 txPackets, UInt64 txBytes, UInt64 elapsed, UInt32 linkSpeed);
+static inline UInt64 intrModLoad(UInt64 packets, UInt64 bytes, UInt64 maxPackets);
+static UInt32 pollTuneSelectProfile(RtlPollTuneState *state, UInt64 packets, UInt64 bytes, UInt64 passes, UInt32 maxBatch, UInt64 elapsed, UInt32 linkSpeed);
+static inline void pollTuneGetParams(const RtlPollTuneProfile *profile, IONetworkPacketPollingParameters *params);
+
+#if ENABLE_PROFILER
+static inline UInt64 profReadCycles();
+static inline UInt32 profBucket(UInt64 value, UInt32 numBuckets);
+static inline void profRecord(RtlProfHist *hist, UInt64 start, UInt32 work);
+#endif
+
+/*
+ * Interrupt moderation profiles ordered from lowest latency to lowest
+ * interrupt rate. The IntrMitigate register holds the tx packet count,
+ * tx timer, rx packet count and rx timer as 4 bit fields (msb first).
+ * The load thresholds are given in per mille of the link's capacity.
+ */
+static const RtlIntrModProfile intrModProfiles[kIntrModNumProfiles] = {
+    /* intrMitigate, upLoad, downLoad */
+    { 0x0000,   50,    0 },
+    { 0x1111,  200,   30 },
+    { 0x5151,  450,  150 },
+    { 0x5f51,  700,  350 },
+    { 0x5f5f, 1001,  600 },
+};
+
+/*
+ * Packet polling parameter profiles for 100 Mbit, ordered from the latest to
+ * the earliest switch to polled mode. The first one holds the driver's static
+ * defaults. Higher profiles enter polled mode with fewer packets and poll more
+ * often, so that the rx ring can't overflow between two polls. The pressure
+ * thresholds are given in per mille.
+ */
+static const RtlPollTuneProfile pollTuneProfiles[kPollTuneNumProfiles] = {
+    /* lowPkts, highPkts, lowBytes, highBytes, pollInterval, upLoad, downLoad */
+    { 10, 40, 0x1000, 0x10000, 1000,   100,    0 },
+    {  6, 24, 0x0c00, 0x0c000, 1000,   300,   60 },
+    {  4, 16, 0x0800, 0x08000,  500,   550,  200 },
+    {  2,  8, 0x0400, 0x04000,  250, 0xffff, 400 },
+};
+
+static const char *pollTuneReasons[kPollTuneReasonCount] = {
+    "Idle", "Load", "Occupancy", "Burst"
+};
+
 #pragma mark --- public methods ---
 
 OSDefineMetaClassAndStructors(RTL8100, super)
@@ -46,6 +107,7 @@ bool RTL8100::init(OSDictionary *properties)
         mediumDict = NULL;
         txQueue = NULL;
         interruptSource = NULL;
+        rxBudgetSource = NULL;
         timerSource = NULL;
         netif = NULL;
         netStats = NULL;
@@ -53,8 +115,15 @@ bool RTL8100::init(OSDictionary *properties)
         baseMap = NULL;
         baseAddr = NULL;
         rxMbufCursor = NULL;
-        txNext2FreeMbuf = NULL;
         txMbufCursor = NULL;
+        txPending = NULL;
+        txHiPending = NULL;
+        txHiPendingTail = NULL;
+        txBounceDesc = NULL;
+        txBouncePhyAddr = NULL;
+        txBounceArray = NULL;
+        txCopyThreshold = 0;
+        txHiQueue = false;
         statBufDesc = NULL;
         statPhyAddr = NULL;
         statData = NULL;
@@ -78,6 +147,37 @@ bool RTL8100::init(OSDictionary *properties)
         pciDeviceData.subsystem_device = 0;
         linuxData.pci_dev = &pciDeviceData;
         intrMitigateValue = 0;
+        adaptiveIntrMit = false;
+        linkChgIntr = false;
+        bzero(&intrMod, sizeof(RtlIntrModState));
+        bzero(&pollTune, sizeof(RtlPollTuneState));
+        adaptivePoll = false;
+        pollTuning = false;
+        rxPoolCount = 0;
+        rxCopybreak = 0;
+        rxBudget = kRxBudgetDefault;
+        rxBudgetPending = false;
+        rxFilterCount = 0;
+        rxFilterMcCount = 0;
+        rxFilterBcastCount = 0;
+        rxFilterMcHashDrops = 0;
+        rxFilterMcFallbackDrops = 0;
+        rxFilterMcExact = false;
+        rxFilterMcTableValid = false;
+        rxFilterMcFallback = false;
+        rxCoalescing = false;
+        rxCoalEvict = 0;
+        outputStartFn = &RTL8100::outputStartPackets<false>;
+        rxInterruptFn = &RTL8100::rxPackets<false>;
+        bzero(rxCoalFlows, sizeof(rxCoalFlows));
+        bzero(&rxPoolStats, sizeof(RtlRxPoolStats));
+        bzero(&txReclaimStats, sizeof(RtlTxReclaimStats));
+        bzero(txQueueStats, sizeof(txQueueStats));
+        bzero(txReclaimQueue, sizeof(txReclaimQueue));
+        bzero(txReclaimHead, sizeof(txReclaimHead));
+        bzero(txReclaimTail, sizeof(txReclaimTail));
+        txReclaimDescs = kTxReclaimDescsDefault;
+        txReclaimDelay = kTxReclaimDelayDefault * 1000;
         wolCapable = false;
         wolActive = false;
         enableTSO4 = false;
@@ -102,6 +202,10 @@ void RTL8100::free()
             workLoop->removeEventSource(interruptSource);
             RELEASE(interruptSource);
         }
+        if (rxBudgetSource) {
+            workLoop->removeEventSource(rxBudgetSource);
+            RELEASE(rxBudgetSource);
+        }
         if (timerSource) {
             workLoop->removeEventSource(timerSource);
             RELEASE(timerSource);
@@ -250,6 +354,10 @@ void RTL8100::stop(IOService *provider)
             workLoop->removeEventSource(interruptSource);
             RELEASE(interruptSource);
         }
+        if (rxBudgetSource) {
+            workLoop->removeEventSource(rxBudgetSource);
+            RELEASE(rxBudgetSource);
+        }
         if (timerSource) {
             workLoop->removeEventSource(timerSource);
             RELEASE(timerSource);
@@ -412,16 +520,19 @@ IOReturn RTL8100::enable(IONetworkInterface *netif)
     }
     selectMedium(selectedMedium);
     setLinkStatus(kIONetworkLinkValid);
+    selectHotPaths();
     enableRTL8100();
     
     /* In case we are using an msi the interrupt hasn't been enabled by start(). */
     interruptSource->enable();
     
-    txDescDoneCount = txDescDoneLast = 0;
+    bzero(txDescDoneCount, sizeof(txDescDoneCount));
+    bzero(txDescDoneLast, sizeof(txDescDoneLast));
     deadlockWarn = 0;
     needsUpdate = false;
     isEnabled = true;
     polling = false;
+    rxBudgetPending = false;
     
     timerSource->setTimeoutMS(kTimeoutMS);
     
@@ -458,10 +569,12 @@ IOReturn RTL8100::disable(IONetworkInterface *netif)
     
     polling = false;
     isEnabled = false;
+    rxBudgetPending = false;
     
     timerSource->cancelTimeout();
     needsUpdate = false;
-    txDescDoneCount = txDescDoneLast = 0;
+    bzero(txDescDoneCount, sizeof(txDescDoneCount));
+    bzero(txDescDoneLast, sizeof(txDescDoneLast));
     
     /* In case we are using msi disable the interrupt. */
     interruptSource->disable();
@@ -518,22 +631,69 @@ done:
  */
 
 IOReturn RTL8100::outputStart(IONetworkInterface *interface, IOOptionBits options )
+{
+    ProfStart(start);
+    UInt64 txPackets __unused = intrMod.txPackets;
+    IOReturn result = (this->*outputStartFn)(interface, options);
+    
+    ProfEnd(kProfOutputStart, start, (UInt32)(intrMod.txPackets - txPackets));
+    
+    return result;
+}
+
+/*
+ * Selects the hot path routines matching the chip's descriptor format once,
+ * so that the per-packet code doesn't have to check revision2.
+ */
+void RTL8100::selectHotPaths()
+{
+    if (revision2) {
+        outputStartFn = &RTL8100::outputStartPackets<true>;
+        rxInterruptFn = &RTL8100::rxPackets<true>;
+    } else {
+        outputStartFn = &RTL8100::outputStartPackets<false>;
+        rxInterruptFn = &RTL8100::rxPackets<false>;
+    }
+}
+
+/*
+ * Transmit path of outputStart(), specialized for the descriptor format.
+ */
+template <bool rev2>
+IOReturn RTL8100::outputStartPackets(IONetworkInterface *interface, IOOptionBits options)
 {
     IOPhysicalSegment txSegments[kMaxSegs];
-    mbuf_t m;
+    mbuf_t m, next, last;
     RtlDmaDesc *desc, *firstDesc;
+    RtlDmaDesc *descArray;
+    mbuf_t *mbufArray;
+    UInt64 *postTime;
     IOReturn result = kIOReturnNoResources;
     UInt32 cmd;
     UInt32 opts2;
     mbuf_tso_request_flags_t tsoFlags;
     mbuf_csum_request_flags_t checksums;
+    RtlHdrInfo hdrInfo;
     UInt32 mssValue;
     UInt32 opts1;
     UInt32 vlanTag;
     UInt32 numSegs;
     UInt32 lastSeg;
+    UInt32 burst;
     UInt32 index;
+    UInt32 nextIndex;
+    UInt32 hiNextIndex;
+    UInt32 descMask;
+    UInt32 bounceSlot;
+    UInt32 numFree;
+    UInt32 hiFree;
+    UInt32 pktLen;
     UInt32 i;
+    UInt64 uptime, now;
+    mbuf_t freeList = NULL;
+    bool copied;
+    bool hiPrio;
+    bool hiPosted = false;
     
     //DebugLog("outputStart() ===>\n");
     
@@ -541,77 +701,251 @@ IOReturn RTL8100::outputStart(IONetworkInterface *interface, IOOptionBits option
         DebugLog("Ethernet [RealtekRTL8100]: Interface down. Dropping packets.\n");
         goto done;
     }
-    while ((txNumFreeDesc > (kMaxSegs + 3)) && (interface->dequeueOutputPackets(1, &m, NULL, NULL, NULL) == kIOReturnSuccess)) {
-        cmd = 0;
-        opts2 = 0;
-        
-        if (mbuf_get_tso_requested(m, &tsoFlags, &mssValue)) {
-            DebugLog("Ethernet [RealtekRTL8100]: mbuf_get_tso_requested() failed. Dropping packet.\n");
-            freePacket(m);
-            continue;
+    /* Dequeue packets in bursts sized to the free descriptors, so that the
+     * per call overhead of dequeueOutputPackets() is shared by a whole burst.
+     * As a single packet may need up to kMaxSegs descriptors, the burst is
+     * limited to the number of worst case packets which fit into the ring
+     * without touching the reserve. Free space is sampled once per burst as
+     * txInterrupt() can only add to it. Packets produced by software segmentation
+     * which didn't fit into the ring are sent first. High priority packets take the
+     * same path but are steered onto their own ring. When it is full, they are never
+     * sent through the normal ring as that could reorder a flow. Instead they are parked
+     * in txHiPending, in order, while the normal ring's packets go on. Parked packets are
+     * sent before anything else as soon as txInterrupt() has freed descriptors.
+     */
+    nextIndex = txNextDescIndex;
+    numFree = txFreeDesc(nextIndex, __atomic_load_n(&txDirtyDescIndex, __ATOMIC_ACQUIRE), kNumTxDesc);
+    hiNextIndex = txHiNextDescIndex;
+    hiFree = txFreeDesc(hiNextIndex, __atomic_load_n(&txHiDirtyDescIndex, __ATOMIC_ACQUIRE), kNumTxHiDesc);
+    
+    for (;;) {
+        if (txHiPending && (hiFree > (kMaxSegs + 3))) {
+            m = txHiPending;
+            txHiPending = txHiPendingTail = NULL;
+        } else if (numFree <= (kMaxSegs + 3)) {
+            break;
+        } else if (txPending) {
+            m = txPending;
+            txPending = NULL;
+        } else {
+            burst = ((numFree - (kMaxSegs + 3)) / kMaxSegs) + 1;
+            
+            if (interface->dequeueOutputPackets(burst, &m, NULL, NULL, NULL) != kIOReturnSuccess)
+                break;
         }
-        if (tsoFlags & (MBUF_TSO_IPV4 | MBUF_TSO_IPV6)) {
-            if (tsoFlags & MBUF_TSO_IPV4) {
-                getTso4Command(&cmd, &opts2, mssValue, tsoFlags);
+        /* The whole burst shares one timestamp for the queue latency statistics. */
+        clock_get_uptime(&uptime);
+        absolutetime_to_nanoseconds(uptime, &now);
+        
+        for (; m; m = next) {
+            next = mbuf_nextpkt(m);
+            mbuf_setnextpkt(m, NULL);
+            
+            cmd = 0;
+            opts2 = 0;
+        
+            if (mbuf_get_tso_requested(m, &tsoFlags, &mssValue)) {
+                DebugLog("Ethernet [RealtekRTL8100]: mbuf_get_tso_requested() failed. Dropping packet.\n");
+                freePacket(m);
+                continue;
+            }
+            /* Select the ring. Interactive and control traffic mustn't wait behind bulk data. */
+            hiPrio = (txHiQueue && !(tsoFlags & (MBUF_TSO_IPV4 | MBUF_TSO_IPV6)) && txHighPriority(m));
+            
+            if (hiPrio) {
+                /* Queue up behind parked packets to keep their order. */
+                if (txHiPending || (hiFree <= (kMaxSegs + 3))) {
+                    if (txHiPending)
+                        mbuf_setnextpkt(txHiPendingTail, m);
+                    else
+                        txHiPending = m;
+                    
+                    txHiPendingTail = m;
+                    continue;
+                }
+            } else if (numFree < (kMaxSegs + 3)) {
+                /* Only possible after software segmentation has expanded the burst. */
+                mbuf_setnextpkt(m, next);
+                txPending = m;
+                break;
+            }
+            if (tsoFlags & (MBUF_TSO_IPV4 | MBUF_TSO_IPV6)) {
+                /* Assume a bare Ethernet/IP header unless the headers are parsed. */
+                hdrInfo.l3Offset = ETHER_HDR_LEN;
+                hdrInfo.l4Offset = (tsoFlags & MBUF_TSO_IPV4) ? kMinL4HdrOffsetV4 : kMinL4HdrOffsetV6;
+                
+                if (rev2 || (tsoFlags & MBUF_TSO_IPV6) || txInlineVlan(m)) {
+                    if (parseHeaders(m, &hdrInfo) && (hdrInfo.l4Proto == IPPROTO_TCP)) {
+                        /* LargeSend and GiantSend can't locate the headers behind an inline VLAN tag.
+                         * GiantSend needs the L4 offset to fit into its field, a bare IPv6 header
+                         * and the headers in the first mbuf. Anything else is segmented in software.
+                         */
+                        if (!rev2 || hdrInfo.inlineVlan || (hdrInfo.l4Offset > GSendL4OffMask) ||
+                            (hdrInfo.isIPv6 && (hdrInfo.l4Offset != hdrInfo.l3Offset + sizeof(struct ip6_hdr))) ||
+                            (mbuf_len(m) < hdrInfo.l4Offset + sizeof(struct tcphdr))) {
+                            if ((m = txSegmentTso(m, mssValue, &hdrInfo))) {
+                                for (last = m; mbuf_nextpkt(last); last = mbuf_nextpkt(last))
+                                    ;
+                                mbuf_setnextpkt(last, next);
+                                next = m;
+                            }
+                            continue;
+                        }
+                    } else if (rev2 || (tsoFlags & MBUF_TSO_IPV4)) {
+                        /* Leave the headers we don't understand to the hardware, like before. */
+                        DebugLog("Ethernet [RealtekRTL8100]: Can't parse TSO packet. Using default offsets.\n");
+                        hdrInfo.l3Offset = ETHER_HDR_LEN;
+                        hdrInfo.l4Offset = (tsoFlags & MBUF_TSO_IPV4) ? kMinL4HdrOffsetV4 : kMinL4HdrOffsetV6;
+                    } else {
+                        DebugLog("Ethernet [RealtekRTL8100]: Unsupported TSO packet. Dropping packet.\n");
+                        freePacket(m);
+                        continue;
+                    }
+                }
+                if (tsoFlags & MBUF_TSO_IPV4) {
+                    getTso4Command<rev2>(&cmd, &opts2, mssValue, hdrInfo.l4Offset);
+                } else {
+                    /* The pseudoheader checksum has to be adjusted first. */
+                    adjustIPv6Header(m, &hdrInfo);
+                    getTso6Command(&cmd, &opts2, mssValue, hdrInfo.l4Offset);
+                }
             } else {
-                /* The pseudoheader checksum has to be adjusted first. */
-                adjustIPv6Header(m);
-                getTso6Command(&cmd, &opts2, mssValue, tsoFlags);
+                /* We use mssValue as a dummy here because it isn't needed anymore. */
+                mbuf_get_csum_requested(m, &checksums, &mssValue);
+                hdrInfo.l4Offset = kMinL4HdrOffsetV6;
+                
+                /* The IPv6 checksum commands need the real L4 offset and frames with an
+                 * inline VLAN tag can't be parsed by the chip. If the hardware can't
+                 * handle the frame, the checksums are calculated in software. Frames
+                 * which can't be parsed are left to the hardware with the default offset.
+                 */
+                if ((rev2 && (checksums & (kChecksumTCPIPv6 | kChecksumUDPIPv6))) ||
+                    (checksums && txInlineVlan(m))) {
+                    if (!parseHeaders(m, &hdrInfo)) {
+                        DebugLog("Ethernet [RealtekRTL8100]: Can't locate checksums. Using default offsets.\n");
+                        hdrInfo.l4Offset = kMinL4HdrOffsetV6;
+                    } else if (!rev2 || !hdrInfo.isIPv6 || (hdrInfo.l4Offset > L4OffMask)) {
+                        if (!txSoftwareChecksum(m, &hdrInfo, checksums)) {
+                            DebugLog("Ethernet [RealtekRTL8100]: Software checksum failed. Dropping packet.\n");
+                            freePacket(m);
+                            continue;
+                        }
+                        checksums = 0;
+                    }
+                }
+                getChecksumCommand<rev2>(&cmd, &opts2, checksums, hdrInfo.l4Offset);
             }
-        } else {
-            /* We use mssValue as a dummy here because it isn't needed anymore. */
-            mbuf_get_csum_requested(m, &checksums, &mssValue);
-            getChecksumCommand(&cmd, &opts2, checksums);
-        }
-        /* Finally get the physical segments. */
-        numSegs = txMbufCursor->getPhysicalSegmentsWithCoalesce(m, &txSegments[0], kMaxSegs);
+            pktLen = mbuf_pkthdr_len(m);
+            copied = (txBounceArray && (pktLen <= txCopyThreshold) && !(tsoFlags & (MBUF_TSO_IPV4 | MBUF_TSO_IPV6)));
+            
+            if (hiPrio) {
+                descArray = txHiDescArray;
+                mbufArray = txHiMbufArray;
+                postTime = txHiPostTime;
+                descMask = kTxHiDescMask;
+                index = hiNextIndex;
+                bounceSlot = kNumTxDesc + index;
+            } else {
+                descArray = txDescArray;
+                mbufArray = txMbufArray;
+                postTime = txPostTime;
+                descMask = kTxDescMask;
+                index = nextIndex;
+                bounceSlot = index;
+            }
+            if (copied) {
+                /* Small packets are copied into the bounce buffer of their descriptor so
+                 * that the mbuf can be released right away.
+                 */
+                if (mbuf_copydata(m, 0, pktLen, txBounceArray + bounceSlot * kTxBounceSlotSize)) {
+                    DebugLog("Ethernet [RealtekRTL8100]: mbuf_copydata() failed. Dropping packet.\n");
+                    freePacket(m);
+                    continue;
+                }
+                txSegments[0].location = txBouncePhyAddr + bounceSlot * kTxBounceSlotSize;
+                txSegments[0].length = pktLen;
+                numSegs = 1;
+            } else {
+                /* Finally get the physical segments. */
+                numSegs = txMbufCursor->getPhysicalSegmentsWithCoalesce(m, &txSegments[0], kMaxSegs);
+            }
+            /* Alloc required number of descriptors. As the descriptor which has been freed last must be
+             * considered to be still in use we never fill the ring completely but leave at least one
+             * unused.
+             */
+            if (!numSegs) {
+                DebugLog("Ethernet [RealtekRTL8100]: getPhysicalSegmentsWithCoalesce() failed. Dropping packet.\n");
+                freePacket(m);
+                continue;
+            }
+            if (hiPrio) {
+                hiFree -= numSegs;
+                hiNextIndex = (hiNextIndex + numSegs) & kTxHiDescMask;
+            } else {
+                numFree -= numSegs;
+                nextIndex = (nextIndex + numSegs) & kTxDescMask;
+            }
+            firstDesc = &descArray[index];
+            lastSeg = numSegs - 1;
         
-        /* Alloc required number of descriptors. As the descriptor which has been freed last must be
-         * considered to be still in use we never fill the ring completely but leave at least one
-         * unused.
-         */
-        if (!numSegs) {
-            DebugLog("Ethernet [RealtekRTL8100]: getPhysicalSegmentsWithCoalesce() failed. Dropping packet.\n");
-            freePacket(m);
-            continue;
-        }
-        OSAddAtomic(-numSegs, &txNumFreeDesc);
-        index = txNextDescIndex;
-        txNextDescIndex = (txNextDescIndex + numSegs) & kTxDescMask;
-        firstDesc = &txDescArray[index];
-        lastSeg = numSegs - 1;
-        
-        /* Next fill in the VLAN tag. */
-        opts2 |= (getVlanTagDemand(m, &vlanTag)) ? (OSSwapInt16(vlanTag) | TxVlanTag) : 0;
-        
-        /* And finally fill in the descriptors. */
-        for (i = 0; i < numSegs; i++) {
-            desc = &txDescArray[index];
-            opts1 = (((UInt32)txSegments[i].length) | cmd);
-            opts1 |= (i == 0) ? FirstFrag : DescOwn;
+            /* Next fill in the VLAN tag. */
+            opts2 |= (getVlanTagDemand(m, &vlanTag)) ? (OSSwapInt16(vlanTag) | TxVlanTag) : 0;
+        
+            /* And finally fill in the descriptors. */
+            for (i = 0; i < numSegs; i++) {
+                desc = &descArray[index];
+                opts1 = (((UInt32)txSegments[i].length) | cmd);
+                opts1 |= (i == 0) ? FirstFrag : DescOwn;
+            
+                if (i == lastSeg) {
+                    opts1 |= LastFrag;
+                    mbufArray[index] = (copied) ? NULL : m;
+                    postTime[index] = now;
+                } else {
+                    mbufArray[index] = NULL;
+                }
+                if (index == descMask)
+                    opts1 |= RingEnd;
+            
+                desc->addr = OSSwapHostToLittleInt64(txSegments[i].location);
+                desc->opts2 = OSSwapHostToLittleInt32(opts2);
+                desc->opts1 = OSSwapHostToLittleInt32(opts1);
+            
+                //DebugLog("opts1=0x%x, opts2=0x%x, addr=0x%llx, len=0x%llx\n", opts1, opts2, txSegments[i].location, txSegments[i].length);
+                ++index &= descMask;
+            }
+            firstDesc->opts1 |= DescOwn;
             
-            if (i == lastSeg) {
-                opts1 |= LastFrag;
-                txMbufArray[index] = m;
+            /* Hand the packet over to txInterrupt(). */
+            if (hiPrio) {
+                __atomic_store_n(&txHiNextDescIndex, hiNextIndex, __ATOMIC_RELEASE);
+                hiPosted = true;
             } else {
-                txMbufArray[index] = NULL;
+                __atomic_store_n(&txNextDescIndex, nextIndex, __ATOMIC_RELEASE);
             }
-            if (index == kTxLastDesc)
-                opts1 |= RingEnd;
             
-            desc->addr = OSSwapHostToLittleInt64(txSegments[i].location);
-            desc->opts2 = OSSwapHostToLittleInt32(opts2);
-            desc->opts1 = OSSwapHostToLittleInt32(opts1);
+            intrMod.txPackets++;
+            intrMod.txBytes += pktLen;
             
-            //DebugLog("opts1=0x%x, opts2=0x%x, addr=0x%llx, len=0x%llx\n", opts1, opts2, txSegments[i].location, txSegments[i].length);
-            ++index &= kTxDescMask;
+            if (copied) {
+                mbuf_setnextpkt(m, freeList);
+                freeList = m;
+            }
         }
-        firstDesc->opts1 |= DescOwn;
+        numFree = txFreeDesc(nextIndex, __atomic_load_n(&txDirtyDescIndex, __ATOMIC_ACQUIRE), kNumTxDesc);
+        hiFree = txFreeDesc(hiNextIndex, __atomic_load_n(&txHiDirtyDescIndex, __ATOMIC_ACQUIRE), kNumTxHiDesc);
     }
-    /* Set the polling bit. */
-    WriteReg8(TxPoll, NPQ);
+    txQueueSample(&txQueueStats[kTxQueueNormal], kNumTxDesc - numFree);
+    txQueueSample(&txQueueStats[kTxQueueHigh], kNumTxHiDesc - hiFree);
+    
+    /* Set the polling bits once for the whole batch. */
+    WriteReg8(TxPoll, (hiPosted) ? (NPQ | HPQ) : NPQ);
+    
+    /* Release the copied packets. */
+    if (freeList)
+        mbuf_freem_list(freeList);
     
-    result = (txNumFreeDesc > (kMaxSegs + 3)) ? kIOReturnSuccess : kIOReturnNoResources;
+    result = (numFree > (kMaxSegs + 3)) ? kIOReturnSuccess : kIOReturnNoResources;
     
 done:
     //DebugLog("outputStart() <===\n");
@@ -889,6 +1223,9 @@ IOReturn RTL8100::setPromiscuousMode(bool active)
         mcFilter[1] = *filterAddr;
     }
     promiscusMode = active;
+    
+    /* All multicasts must pass in promiscuous mode. */
+    rxFilterMcExact = (!active && rxFilterMcTableValid);
     rxMode |= (ReadReg32(RxConfig) & rxConfigMask);
     WriteReg32(RxConfig, rxMode);
     WriteReg32(MAR0, mcFilter[0]);
@@ -971,14 +1308,33 @@ IOReturn RTL8100::setMulticastList(IOEthernetAddress *addrs, UInt32 count)
     
     DebugLog("setMulticastList() ===>\n");
     
+    /* The early rx filter keeps an exact copy of the list in order to drop the
+     * multicasts which pass the hash filter by mistake. It covers much longer
+     * lists than the hash filter, which accepts all multicasts above its limit.
+     * The table isn't used in promiscuous mode.
+     */
+    if (count <= kMCTableLimit) {
+        bzero(rxFilterMcTable, sizeof(rxFilterMcTable));
+        
+        for (i = 0; i < count; i++)
+            mcTableInsert(rxFilterMcTable, addrs[i].bytes);
+        
+        rxFilterMcCount = count;
+        rxFilterMcTableValid = true;
+    } else {
+        rxFilterMcTableValid = false;
+    }
+    rxFilterMcExact = (rxFilterMcTableValid && !promiscusMode);
     if (count <= kMCFilterLimit) {
         for (i = 0; i < count; i++, addrs++) {
             bitNumber = ether_crc(6, reinterpret_cast<unsigned char *>(addrs)) >> 26;
-            filter |= (1 << (bitNumber & 0x3f));
+            filter |= (1ULL << (bitNumber & 0x3f));
         }
         multicastFilter = OSSwapInt64(filter);
+        rxFilterMcFallback = false;
     } else {
         multicastFilter = 0xffffffffffffffff;
+        rxFilterMcFallback = true;
     }
     WriteReg32(MAR0, *filterAddr++);
     WriteReg32(MAR1, *filterAddr);
@@ -1146,7 +1502,8 @@ UInt32 RTL8100::getFeatures() const
     if (enableTSO4)
         features |= kIONetworkFeatureTSOIPv4;
     
-    if (enableTSO6 && revision2)
+    /* Chips without GiantSend support for IPv6 use software segmentation. */
+    if (enableTSO6)
         features |= kIONetworkFeatureTSOIPv6;
     
     DebugLog("getFeatures() <===\n");
@@ -1250,11 +1607,21 @@ done:
 void RTL8100::getParams()
 {
     OSNumber *intrMit;
+    OSNumber *copybreak;
+    OSNumber *budget;
+    OSNumber *copyThreshold;
+    OSNumber *reclaimDescs;
+    OSNumber *reclaimDelay;
+    OSBoolean *adaptive;
+    OSBoolean *adaptivePolling;
+    OSBoolean *coalesce;
+    OSBoolean *hiQueue;
     OSBoolean *poll;
     OSBoolean *tso4;
     OSBoolean *tso6;
     OSBoolean *csoV6;
     OSBoolean *noASPM;
+    OSDictionary *filterConfig;
     OSString *versionString;
     
     noASPM = OSDynamicCast(OSBoolean, getProperty(kDisableASPMName));
@@ -1291,6 +1658,81 @@ void RTL8100::getParams()
     if (intrMit && !rxPoll)
         intrMitigateValue = intrMit->unsigned16BitValue();
     
+    /* Adaptive interrupt moderation replaces the fixed value when rx polling is off. */
+    adaptive = OSDynamicCast(OSBoolean, getProperty(kAdaptiveIntrMitName));
+    adaptiveIntrMit = (adaptive && !rxPoll) ? adaptive->getValue() : false;
+    
+    IOLog("Ethernet [RealtekRTL8100]: Adaptive interrupt moderation %s.\n", adaptiveIntrMit ? onName : offName);
+    
+    /* With rx polling the polling parameters can be retuned according to the traffic. */
+    adaptivePolling = OSDynamicCast(OSBoolean, getProperty(kAdaptivePollName));
+    adaptivePoll = (adaptivePolling && rxPoll) ? adaptivePolling->getValue() : false;
+    
+    IOLog("Ethernet [RealtekRTL8100]: Adaptive polling parameters %s.\n", adaptivePoll ? onName : offName);
+    
+    /* Received frames smaller than rxCopybreak are copied, leaving the DMA buffer in place. */
+    copybreak = OSDynamicCast(OSNumber, getProperty(kRxCopybreakName));
+    rxCopybreak = (copybreak) ? copybreak->unsigned32BitValue() : 0;
+    
+    if (rxCopybreak > kRxBufferPktSize)
+        rxCopybreak = kRxBufferPktSize;
+    
+    IOLog("Ethernet [RealtekRTL8100]: Rx copybreak %u bytes.\n", rxCopybreak);
+    
+    /* Without rx polling the interrupt handler receives at most rxBudget packets per pass. */
+    budget = OSDynamicCast(OSNumber, getProperty(kRxBudgetName));
+    rxBudget = (budget) ? budget->unsigned32BitValue() : kRxBudgetDefault;
+    
+    if (rxBudget < 1)
+        rxBudget = 1;
+    else if (rxBudget > kNumRxDesc)
+        rxBudget = kNumRxDesc;
+    
+    if (!rxPoll)
+        IOLog("Ethernet [RealtekRTL8100]: Rx budget %u packets.\n", rxBudget);
+    
+    coalesce = OSDynamicCast(OSBoolean, getProperty(kRxCoalescingName));
+    rxCoalescing = (coalesce) ? coalesce->getValue() : false;
+    
+    IOLog("Ethernet [RealtekRTL8100]: TCP receive coalescing %s.\n", rxCoalescing ? onName : offName);
+    
+    /* Unwanted frames are dropped by the early rx filter before any buffer is allocated. */
+    filterConfig = OSDynamicCast(OSDictionary, getProperty(kRxFilterName));
+    rxFilterCompile(filterConfig);
+    
+    /* Packets up to txCopyThreshold bytes are copied into the tx bounce buffers. */
+    copyThreshold = OSDynamicCast(OSNumber, getProperty(kTxCopyThresholdName));
+    txCopyThreshold = (copyThreshold) ? copyThreshold->unsigned32BitValue() : kTxCopyThresholdDefault;
+    
+    if (txCopyThreshold > kTxBounceSlotSize)
+        txCopyThreshold = kTxBounceSlotSize;
+    
+    IOLog("Ethernet [RealtekRTL8100]: Tx copy threshold %u bytes.\n", txCopyThreshold);
+    
+    /* Transmitted packets are released after txReclaimDescs further descriptors have been
+     * returned or txReclaimDelay µs have passed, whichever comes first.
+     */
+    reclaimDescs = OSDynamicCast(OSNumber, getProperty(kTxReclaimDescsName));
+    txReclaimDescs = (reclaimDescs) ? reclaimDescs->unsigned32BitValue() : kTxReclaimDescsDefault;
+    
+    if (txReclaimDescs < 1)
+        txReclaimDescs = 1;
+    else if (txReclaimDescs > kTxReclaimQueueSize - 1)
+        txReclaimDescs = kTxReclaimQueueSize - 1;
+    
+    reclaimDelay = OSDynamicCast(OSNumber, getProperty(kTxReclaimDelayName));
+    txReclaimDelay = (reclaimDelay) ? reclaimDelay->unsigned32BitValue() : kTxReclaimDelayDefault;
+    
+    IOLog("Ethernet [RealtekRTL8100]: Tx reclaim after %u descriptors or %llu µs.\n", txReclaimDescs, txReclaimDelay);
+    
+    txReclaimDelay *= 1000;
+    
+    /* Interactive and control traffic is sent through the high priority queue. */
+    hiQueue = OSDynamicCast(OSBoolean, getProperty(kTxHiQueueName));
+    txHiQueue = (hiQueue) ? hiQueue->getValue() : false;
+    
+    IOLog("Ethernet [RealtekRTL8100]: High priority tx queue %s.\n", txHiQueue ? onName : offName);
+    
     versionString = OSDynamicCast(OSString, getProperty(kDriverVersionName));
     
     if (versionString)
@@ -1368,8 +1810,9 @@ error1:
 }
 
 /*
- * Creates and initializes the interrupt handler and the watchdog timer
- * adding them as event sources to the driver's workloop.
+ * Creates and initializes the interrupt handler, the watchdog timer and
+ * the rx budget event source adding them as event sources to the driver's
+ * workloop.
  */
 bool RTL8100::initEventSources(IOService *provider)
 {
@@ -1417,11 +1860,25 @@ bool RTL8100::initEventSources(IOService *provider)
     }
     workLoop->addEventSource(timerSource);
     
+    /* Receive passes which use up their budget are continued by a software interrupt. */
+    if (!rxPoll) {
+        rxBudgetSource = IOInterruptEventSource::interruptEventSource(this, OSMemberFunctionCast(IOInterruptEventSource::Action, this, &RTL8100::rxBudgetOccurred));
+        
+        if (!rxBudgetSource) {
+            IOLog("Ethernet [RealtekRTL8100]: Failed to create rx budget event source.\n");
+            goto error3;
+        }
+        workLoop->addEventSource(rxBudgetSource);
+    }
     result = true;
     
 done:
     return result;
     
+error3:
+    workLoop->removeEventSource(timerSource);
+    RELEASE(timerSource);
+    
 error2:
     workLoop->removeEventSource(interruptSource);
     RELEASE(interruptSource);
@@ -1442,14 +1899,13 @@ error1:
 bool RTL8100::setupDMADescriptors()
 {
     IOPhysicalSegment rxSegment;
-    mbuf_t spareMbuf[kRxNumSpareMbufs];
     mbuf_t m;
     UInt32 i;
     UInt32 opts1;
     bool result = false;
     
-    /* Create transmitter descriptor array. */
-    txBufDesc = IOBufferMemoryDescriptor::inTaskWithPhysicalMask(kernel_task, (kIODirectionInOut | kIOMemoryPhysicallyContiguous | kIOMapInhibitCache), kTxDescSize, 0xFFFFFFFFFFFFFF00ULL);
+    /* Create transmitter descriptor arrays. The high priority ring follows the normal one. */
+    txBufDesc = IOBufferMemoryDescriptor::inTaskWithPhysicalMask(kernel_task, (kIODirectionInOut | kIOMemoryPhysicallyContiguous | kIOMapInhibitCache), kTxDescSize + kTxHiDescSize, 0xFFFFFFFFFFFFFF00ULL);
     
     if (!txBufDesc) {
         IOLog("Ethernet [RealtekRTL8100]: Couldn't alloc txBufDesc.\n");
@@ -1460,17 +1916,25 @@ bool RTL8100::setupDMADescriptors()
         goto error1;
     }
     txDescArray = (RtlDmaDesc *)txBufDesc->getBytesNoCopy();
+    txHiDescArray = txDescArray + kNumTxDesc;
     txPhyAddr = OSSwapHostToLittleInt64(txBufDesc->getPhysicalAddress());
+    txHiPhyAddr = OSSwapHostToLittleInt64(txBufDesc->getPhysicalAddress() + kTxDescSize);
     
-    /* Initialize txDescArray. */
-    bzero(txDescArray, kTxDescSize);
+    /* Initialize txDescArray and txHiDescArray. */
+    bzero(txDescArray, kTxDescSize + kTxHiDescSize);
     txDescArray[kTxLastDesc].opts1 = OSSwapHostToLittleInt32(RingEnd);
+    txHiDescArray[kTxHiLastDesc].opts1 = OSSwapHostToLittleInt32(RingEnd);
     
     for (i = 0; i < kNumTxDesc; i++) {
         txMbufArray[i] = NULL;
+        txPostTime[i] = 0;
+    }
+    for (i = 0; i < kNumTxHiDesc; i++) {
+        txHiMbufArray[i] = NULL;
+        txHiPostTime[i] = 0;
     }
     txNextDescIndex = txDirtyDescIndex = 0;
-    txNumFreeDesc = kNumTxDesc;
+    txHiNextDescIndex = txHiDirtyDescIndex = 0;
     txMbufCursor = IOMbufNaturalMemoryCursor::withSpecification(0x4000, kMaxSegs);
     
     if (!txMbufCursor) {
@@ -1478,6 +1942,21 @@ bool RTL8100::setupDMADescriptors()
         goto error2;
     }
     
+    /* Create the tx bounce buffers unless copying is disabled. As they are optional,
+     * a failure only disables copying.
+     */
+    if (txCopyThreshold) {
+        txBounceDesc = IOBufferMemoryDescriptor::inTaskWithPhysicalMask(kernel_task, (kIODirectionOut | kIOMemoryPhysicallyContiguous), kTxBounceSize, 0xFFFFFFFFFFFFFF00ULL);
+        
+        if (txBounceDesc && (txBounceDesc->prepare() == kIOReturnSuccess)) {
+            txBounceArray = (UInt8 *)txBounceDesc->getBytesNoCopy();
+            txBouncePhyAddr = txBounceDesc->getPhysicalAddress();
+        } else {
+            IOLog("Ethernet [RealtekRTL8100]: Couldn't alloc txBounceDesc. Tx copying disabled.\n");
+            RELEASE(txBounceDesc);
+        }
+    }
+    
     /* Create receiver descriptor array. */
     rxBufDesc = IOBufferMemoryDescriptor::inTaskWithPhysicalMask(kernel_task, (kIODirectionInOut | kIOMemoryPhysicallyContiguous | kIOMapInhibitCache), kRxDescSize, 0xFFFFFFFFFFFFFF00ULL);
     
@@ -1546,16 +2025,10 @@ bool RTL8100::setupDMADescriptors()
     /* Initialize statData. */
     bzero(statData, sizeof(RtlStatData));
     
-    /* Allocate some spare mbufs and free them in order to increase the buffer pool.
-     * This seems to avoid the replaceOrCopyPacket() errors under heavy load.
+    /* Fill the receive buffer pool. A partially filled pool isn't fatal
+     * as the receiver falls back to replaceOrCopyPacket() when it runs dry.
      */
-    for (i = 0; i < kRxNumSpareMbufs; i++)
-        spareMbuf[i] = allocatePacket(kRxBufferPktSize);
-    
-    for (i = 0; i < kRxNumSpareMbufs; i++) {
-        if (spareMbuf[i])
-            freePacket(spareMbuf[i]);
-    }
+    rxPoolRefill(kRxPoolSize);
     result = true;
     
 done:
@@ -1582,6 +2055,12 @@ error4:
     rxBufDesc = NULL;
     
 error3:
+    if (txBounceDesc) {
+        txBounceDesc->complete();
+        txBounceDesc->release();
+        txBounceDesc = NULL;
+        txBounceArray = NULL;
+    }
     RELEASE(txMbufCursor);
     
 error2:
@@ -1602,23 +2081,33 @@ void RTL8100::freeDMADescriptors()
         txBufDesc->release();
         txBufDesc = NULL;
         txPhyAddr = NULL;
+        txHiPhyAddr = NULL;
     }
     RELEASE(txMbufCursor);
     
+    if (txBounceDesc) {
+        txBounceDesc->complete();
+        txBounceDesc->release();
+        txBounceDesc = NULL;
+        txBouncePhyAddr = NULL;
+        txBounceArray = NULL;
+    }
+    
     if (rxBufDesc) {
         rxBufDesc->complete();
         rxBufDesc->release();
         rxBufDesc = NULL;
         rxPhyAddr = NULL;
     }
-    RELEASE(rxMbufCursor);
-    
     for (i = 0; i < kNumRxDesc; i++) {
         if (rxMbufArray[i]) {
             freePacket(rxMbufArray[i]);
             rxMbufArray[i] = NULL;
         }
     }
+    rxPoolFree();
+    RELEASE(rxMbufCursor);
+    
     if (statBufDesc) {
         statBufDesc->complete();
         statBufDesc->release();
@@ -1629,7 +2118,7 @@ void RTL8100::freeDMADescriptors()
 }
 
 /*
- * Clears the tx descriptor ring freeing all packets in the queue.
+ * Clears the tx descriptor rings freeing all packets in the queue.
  * Called when the link was lost or the interface is disabled.
  */
 void RTL8100::txClearDescriptors()
@@ -1640,12 +2129,19 @@ void RTL8100::txClearDescriptors()
     
     DebugLog("txClearDescriptors() ===>\n");
     
-    if (txNext2FreeMbuf) {
-        freePacket(txNext2FreeMbuf);
-        txNext2FreeMbuf = NULL;
+    txReclaimRelease(txReclaimCollect(NULL, 0, true));
+    
+    if (txPending) {
+        mbuf_freem_list(txPending);
+        txPending = NULL;
+    }
+    if (txHiPending) {
+        mbuf_freem_list(txHiPending);
+        txHiPending = txHiPendingTail = NULL;
     }
     for (i = 0; i < kNumTxDesc; i++) {
         txDescArray[i].opts1 = OSSwapHostToLittleInt32((i != lastIndex) ? 0 : RingEnd);
+        txPostTime[i] = 0;
         m = txMbufArray[i];
         
         if (m) {
@@ -1654,11 +2150,288 @@ void RTL8100::txClearDescriptors()
         }
     }
     txDirtyDescIndex = txNextDescIndex = 0;
-    txNumFreeDesc = kNumTxDesc;
+    
+    for (i = 0; i < kNumTxHiDesc; i++) {
+        txHiDescArray[i].opts1 = OSSwapHostToLittleInt32((i != kTxHiLastDesc) ? 0 : RingEnd);
+        txHiPostTime[i] = 0;
+        m = txHiMbufArray[i];
+        
+        if (m) {
+            freePacket(m);
+            txHiMbufArray[i] = NULL;
+        }
+    }
+    txHiDirtyDescIndex = txHiNextDescIndex = 0;
     
     DebugLog("txClearDescriptors() <===\n");
 }
 
+/*
+ * Tops up the receive buffer pool with freshly mapped buffers until it holds
+ * target buffers or an allocation fails. Called outside of the receiver's
+ * per-packet loop in order to keep the allocator out of the fast path.
+ */
+void RTL8100::rxPoolRefill(UInt32 target)
+{
+    IOPhysicalSegment rxSegment;
+    UInt64 start, end, elapsed;
+    mbuf_t m;
+    
+    if (target > kRxPoolSize)
+        target = kRxPoolSize;
+    
+    if (rxPoolCount >= target)
+        return;
+    
+    clock_get_uptime(&start);
+    
+    while (rxPoolCount < target) {
+        m = allocatePacket(kRxBufferPktSize);
+        
+        if (!m)
+            break;
+        
+        if (rxMbufCursor->getPhysicalSegmentsWithCoalesce(m, &rxSegment, 1) != 1) {
+            freePacket(m);
+            break;
+        }
+        rxPool[rxPoolCount].mbuf = m;
+        rxPool[rxPoolCount].phyAddr = rxSegment.location;
+        rxPool[rxPoolCount].length = (UInt32)rxSegment.length;
+        rxPoolCount++;
+    }
+    clock_get_uptime(&end);
+    absolutetime_to_nanoseconds(end - start, &elapsed);
+    
+    rxPoolStats.refills++;
+    rxPoolStats.refillTime += elapsed;
+    
+    if (elapsed > rxPoolStats.refillTimeMax)
+        rxPoolStats.refillTimeMax = elapsed;
+}
+
+/*
+ * Releases all buffers held by the receive buffer pool.
+ */
+void RTL8100::rxPoolFree()
+{
+    while (rxPoolCount > 0) {
+        rxPoolCount--;
+        freePacket(rxPool[rxPoolCount].mbuf);
+        rxPool[rxPoolCount].mbuf = NULL;
+    }
+}
+
+/*
+ * Publishes the hit counts of the early rx filter rules in the registry.
+ * Called by the watchdog timer.
+ */
+void RTL8100::rxFilterUpdateStats()
+{
+    static const char *ruleNames[kRxFilterOpCount] = { "Broadcast", "Multicast", "Vlan", "EtherType" };
+    OSDictionary *dict = OSDictionary::withCapacity(kRxFilterMaxRules);
+    RtlRxFilterRule *rule;
+    OSNumber *num;
+    char name[kNameLenght];
+    UInt32 i;
+    
+    if (!dict)
+        return;
+    
+    for (i = 0; i < rxFilterCount; i++) {
+        rule = &rxFilterRules[i];
+        
+        if (rule->op == kRxFilterOpEtherTypeDrop)
+            snprintf(name, kNameLenght, "%s 0x%04x", ruleNames[rule->op], ntohs((UInt16)rule->arg));
+        else
+            snprintf(name, kNameLenght, "%s", ruleNames[rule->op]);
+        
+        if ((num = OSNumber::withNumber(rule->hits, 64))) {
+            dict->setObject(name, num);
+            num->release();
+        }
+        if (rule->op == kRxFilterOpMulticastExact) {
+            if ((num = OSNumber::withNumber(rxFilterMcCount, 32))) {
+                dict->setObject("MulticastAddresses", num);
+                num->release();
+            }
+            if ((num = OSNumber::withNumber(rxFilterMcHashDrops, 64))) {
+                dict->setObject("MulticastHashCollisions", num);
+                num->release();
+            }
+            if ((num = OSNumber::withNumber(rxFilterMcFallbackDrops, 64))) {
+                dict->setObject("MulticastFallbackDrops", num);
+                num->release();
+            }
+        }
+    }
+    setProperty(kRxFilterStatsName, dict);
+    dict->release();
+}
+
+/*
+ * Publishes the receive buffer pool's statistics in the registry.
+ * Called by the watchdog timer.
+ */
+void RTL8100::rxPoolUpdateStats()
+{
+    OSDictionary *dict = OSDictionary::withCapacity(6);
+    OSNumber *num;
+    UInt64 avgTime = rxPoolStats.refills ? (rxPoolStats.refillTime / rxPoolStats.refills) : 0;
+    
+    if (!dict)
+        return;
+    
+    if ((num = OSNumber::withNumber(rxPoolCount, 32))) {
+        dict->setObject("Available", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(rxPoolStats.hits, 64))) {
+        dict->setObject("Hits", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(rxPoolStats.misses, 64))) {
+        dict->setObject("Misses", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(rxPoolStats.refills, 64))) {
+        dict->setObject("Refills", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(avgTime, 64))) {
+        dict->setObject("RefillTimeAvgNs", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(rxPoolStats.refillTimeMax, 64))) {
+        dict->setObject("RefillTimeMaxNs", num);
+        num->release();
+    }
+    setProperty(kRxPoolStatsName, dict);
+    dict->release();
+}
+
+/*
+ * Removes the packets which are safe to be freed from the heads of the deferred reclaim
+ * queues and chains them up to freeList. A packet is safe once txReclaimDescs descriptors
+ * of its own ring have been returned after its own or txReclaimDelay ns have passed.
+ * Each ring has its own queue, ordered by completion, so that the scan of a queue stops
+ * at its first packet which isn't safe yet without holding up the other ring.
+ * With all set, the queues are emptied unconditionally.
+ */
+mbuf_t RTL8100::txReclaimCollect(mbuf_t freeList, UInt64 now, bool all)
+{
+    RtlTxReclaimEntry *entry;
+    UInt32 ring;
+    
+    for (ring = 0; ring < kTxQueueCount; ring++) {
+        while (txReclaimHead[ring] != txReclaimTail[ring]) {
+            entry = &txReclaimQueue[ring][txReclaimHead[ring] & kTxReclaimQueueMask];
+            
+            if (!all && ((txDescDoneCount[ring] - entry->doneCount) < txReclaimDescs) &&
+                (!txReclaimDelay || ((now - entry->doneTime) < txReclaimDelay)))
+                break;
+            
+            mbuf_setnextpkt(entry->mbuf, freeList);
+            freeList = entry->mbuf;
+            entry->mbuf = NULL;
+            txReclaimHead[ring]++;
+        }
+    }
+    return freeList;
+}
+
+/*
+ * Frees a list of transmitted packets with a single call.
+ */
+void RTL8100::txReclaimRelease(mbuf_t freeList)
+{
+    UInt32 numFreed;
+    
+    if (!freeList)
+        return;
+    
+    numFreed = mbuf_freem_list(freeList);
+    txReclaimStats.batches++;
+    txReclaimStats.packets += numFreed;
+    
+    if (numFreed > txReclaimStats.maxBatch)
+        txReclaimStats.maxBatch = numFreed;
+}
+
+void RTL8100::txReclaimUpdateStats()
+{
+    OSDictionary *dict = OSDictionary::withCapacity(3);
+    OSNumber *num;
+    
+    if (!dict)
+        return;
+    
+    if ((num = OSNumber::withNumber(txReclaimStats.batches, 64))) {
+        dict->setObject("Batches", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(txReclaimStats.packets, 64))) {
+        dict->setObject("Packets", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(txReclaimStats.maxBatch, 32))) {
+        dict->setObject("MaxBatch", num);
+        num->release();
+    }
+    setProperty(kTxReclaimStatsName, dict);
+    dict->release();
+}
+
+void RTL8100::txQueueUpdateStats()
+{
+    static const char *queueNames[kTxQueueCount] = { "Normal", "HighPriority" };
+    static const UInt32 queueSizes[kTxQueueCount] = { kNumTxDesc, kNumTxHiDesc };
+    OSDictionary *dict = OSDictionary::withCapacity(kTxQueueCount);
+    OSDictionary *queueDict;
+    OSNumber *num;
+    RtlTxQueueStats *stats;
+    UInt32 i;
+    
+    if (!dict)
+        return;
+    
+    for (i = 0; i < kTxQueueCount; i++) {
+        stats = &txQueueStats[i];
+        
+        if (!(queueDict = OSDictionary::withCapacity(6)))
+            continue;
+        
+        if ((num = OSNumber::withNumber(queueSizes[i], 32))) {
+            queueDict->setObject("Descriptors", num);
+            num->release();
+        }
+        if ((num = OSNumber::withNumber(stats->packets, 64))) {
+            queueDict->setObject("Packets", num);
+            num->release();
+        }
+        if ((num = OSNumber::withNumber(stats->packets ? (stats->latency / stats->packets) : 0, 64))) {
+            queueDict->setObject("LatencyAvgNs", num);
+            num->release();
+        }
+        if ((num = OSNumber::withNumber(stats->latencyMax, 64))) {
+            queueDict->setObject("LatencyMaxNs", num);
+            num->release();
+        }
+        if ((num = OSNumber::withNumber(stats->samples ? (stats->occupancy / stats->samples) : 0, 32))) {
+            queueDict->setObject("OccupancyAvg", num);
+            num->release();
+        }
+        if ((num = OSNumber::withNumber(stats->occupancyMax, 32))) {
+            queueDict->setObject("OccupancyMax", num);
+            num->release();
+        }
+        dict->setObject(queueNames[i], queueDict);
+        queueDict->release();
+    }
+    setProperty(kTxQueueStatsName, dict);
+    dict->release();
+}
+
 #pragma mark --- common interrupt methods ---
 
 void RTL8100::pciErrorInterrupt()
@@ -1691,39 +2464,113 @@ void RTL8100::pciErrorInterrupt()
  * - delay freeing packets until the next descriptor has been finished or a
  *   small period of time has passed (as these packets are really small a
  *   few µ secs should be enough).
+ *
+ * Completed packets are kept in the deferred reclaim queue until txReclaimDescs
+ * further descriptors have been returned or txReclaimDelay has passed.
  */
 
 void RTL8100::txInterrupt()
 {
-    SInt32 numDirty = kNumTxDesc - txNumFreeDesc;
+    ProfStart(start);
+    UInt32 nextIndex = __atomic_load_n(&txNextDescIndex, __ATOMIC_ACQUIRE);
+    UInt32 hiNextIndex = __atomic_load_n(&txHiNextDescIndex, __ATOMIC_ACQUIRE);
     UInt32 oldDirtyIndex = txDirtyDescIndex;
-    UInt32 descStatus;
+    UInt32 oldHiDirtyIndex = txHiDirtyDescIndex;
+    UInt32 dirtyIndex, hiDirtyIndex;
+    UInt8 pollMask = 0;
+    mbuf_t freeList = NULL;
+    UInt64 uptime, now;
     
-    while (numDirty-- > 0) {
-        descStatus = OSSwapLittleToHostInt32(txDescArray[txDirtyDescIndex].opts1);
-        
-        if (descStatus & DescOwn)
-            break;
+    clock_get_uptime(&uptime);
+    absolutetime_to_nanoseconds(uptime, &now);
+    
+    hiDirtyIndex = txCompleteDescs(txHiDescArray, txHiMbufArray, txHiPostTime, kTxHiDescMask, hiNextIndex, oldHiDirtyIndex, now, &freeList, kTxQueueHigh);
+    dirtyIndex = txCompleteDescs(txDescArray, txMbufArray, txPostTime, kTxDescMask, nextIndex, oldDirtyIndex, now, &freeList, kTxQueueNormal);
+    
+    /* Collect the packets which are safe now and free them in a single batch. */
+    txReclaimRelease(txReclaimCollect(freeList, now, false));
+    
+    /* Return the whole batch to outputStart() at once. */
+    if (oldHiDirtyIndex != hiDirtyIndex) {
+        __atomic_store_n(&txHiDirtyDescIndex, hiDirtyIndex, __ATOMIC_RELEASE);
         
-        /* Now it's time to free the last mbuf as we can be sure it's not in use anymore. */
-        if (txNext2FreeMbuf)
-            freePacket(txNext2FreeMbuf, kDelayFree);
+        /* outputStart() may have stalled waiting for room on the high priority ring. */
+        if (txFreeDesc(hiNextIndex, hiDirtyIndex, kNumTxHiDesc) > (kMaxSegs + 3))
+            netif->signalOutputThread();
         
-        txNext2FreeMbuf = txMbufArray[txDirtyDescIndex];
-        txMbufArray[txDirtyDescIndex] = NULL;
-        txDescDoneCount++;
-        OSIncrementAtomic(&txNumFreeDesc);
-        ++txDirtyDescIndex &= kTxDescMask;
+        pollMask |= HPQ;
     }
-    if (oldDirtyIndex != txDirtyDescIndex) {
-        if (txNumFreeDesc > kTxQueueWakeTreshhold)
+    if (oldDirtyIndex != dirtyIndex) {
+        __atomic_store_n(&txDirtyDescIndex, dirtyIndex, __ATOMIC_RELEASE);
+        
+        if (txFreeDesc(nextIndex, dirtyIndex, kNumTxDesc) > kTxQueueWakeTreshhold)
             netif->signalOutputThread();
         
-        WriteReg8(TxPoll, NPQ);
-        releaseFreePackets();
+        pollMask |= NPQ;
     }
+    if (pollMask)
+        WriteReg8(TxPoll, pollMask);
+    
     if (!polling)
         etherStats->dot3TxExtraEntry.interrupts++;
+    
+    ProfEnd(kProfTxInterrupt, start, ((dirtyIndex - oldDirtyIndex) & kTxDescMask) + ((hiDirtyIndex - oldHiDirtyIndex) & kTxHiDescMask));
+}
+
+/*
+ * Walks a tx ring from dirtyIndex up to nextIndex and hands the packets of the
+ * descriptors returned by the chip over to the deferred reclaim queue. Packets
+ * pushed out of a full reclaim queue are chained up to freeList. ring selects
+ * the descriptor counter and statistics. Returns the new dirty index.
+ */
+UInt32 RTL8100::txCompleteDescs(RtlDmaDesc *descArray, mbuf_t *mbufArray, UInt64 *postTime, UInt32 descMask, UInt32 nextIndex, UInt32 dirtyIndex, UInt64 now, mbuf_t *freeList, UInt32 ring)
+{
+    RtlTxQueueStats *stats = &txQueueStats[ring];
+    SInt32 numDirty = (nextIndex - dirtyIndex) & descMask;
+    UInt32 descStatus;
+    RtlTxReclaimEntry *entry;
+    UInt64 latency;
+    mbuf_t m;
+    
+    while (numDirty-- > 0) {
+        descStatus = OSSwapLittleToHostInt32(descArray[dirtyIndex].opts1);
+        
+        if (descStatus & DescOwn)
+            break;
+        
+        /* Only the last descriptor of a packet carries its posting time. */
+        if (postTime[dirtyIndex]) {
+            latency = now - postTime[dirtyIndex];
+            postTime[dirtyIndex] = 0;
+            stats->packets++;
+            stats->latency += latency;
+            
+            if (latency > stats->latencyMax)
+                stats->latencyMax = latency;
+        }
+        m = mbufArray[dirtyIndex];
+        mbufArray[dirtyIndex] = NULL;
+        txDescDoneCount[ring]++;
+        ++dirtyIndex &= descMask;
+        
+        if (!m)
+            continue;
+        
+        /* Don't free the packet yet but tag it with its ring's completion count and the
+         * time. A full queue means that the oldest packet has been followed by more than
+         * txReclaimDescs descriptors of the same ring, so that it can be released right away.
+         */
+        if ((txReclaimTail[ring] - txReclaimHead[ring]) == kTxReclaimQueueSize) {
+            entry = &txReclaimQueue[ring][txReclaimHead[ring]++ & kTxReclaimQueueMask];
+            mbuf_setnextpkt(entry->mbuf, *freeList);
+            *freeList = entry->mbuf;
+        }
+        entry = &txReclaimQueue[ring][txReclaimTail[ring]++ & kTxReclaimQueueMask];
+        entry->mbuf = m;
+        entry->doneCount = txDescDoneCount[ring];
+        entry->doneTime = now;
+    }
+    return dirtyIndex;
 }
 
 /*
@@ -1732,21 +2579,47 @@ void RTL8100::txInterrupt()
  * Also called by pollInputPackets() while polling for received packets is acitve.
  */
 UInt32 RTL8100::rxInterrupt(IONetworkInterface *interface, uint32_t maxCount, IOMbufQueue *pollQueue, void *context)
+{
+    ProfStart(start);
+    UInt32 packets = (this->*rxInterruptFn)(interface, maxCount, pollQueue, context);
+    
+    if (pollTuning) {
+        if (packets) {
+            pollTune.rxPasses++;
+            
+            if (packets > pollTune.rxMaxBatch)
+                pollTune.rxMaxBatch = packets;
+        }
+        pollTuneSample();
+    }
+    ProfEnd(kProfRxInterrupt, start, packets);
+    
+    return packets;
+}
+
+/*
+ * Receive path of rxInterrupt(), specialized for the descriptor format. Returns
+ * the number of frames processed, including those dropped by the early filter,
+ * as they use up maxCount as well. A result of maxCount means that the ring may
+ * still hold received frames.
+ */
+template <bool rev2>
+UInt32 RTL8100::rxPackets(IONetworkInterface *interface, uint32_t maxCount, IOMbufQueue *pollQueue, void *context)
 {
     IOPhysicalSegment rxSegment;
     RtlDmaDesc *desc = &rxDescArray[rxNextDescIndex];
     mbuf_t bufPkt, newPkt;
     UInt64 addr;
-    UInt32 opts1, opts2;
+    UInt32 opts1;
     UInt32 descStatus1, descStatus2;
     UInt32 pktSize;
     UInt32 goodPkts = 0;
+    UInt32 droppedPkts = 0;
     UInt16 vlanTag;
     bool replaced;
     
-    while (!((descStatus1 = OSSwapLittleToHostInt32(desc->opts1)) & DescOwn) && (goodPkts < maxCount)) {
+    while (!((descStatus1 = OSSwapLittleToHostInt32(desc->opts1)) & DescOwn) && ((goodPkts + droppedPkts) < maxCount)) {
         opts1 = (rxNextDescIndex == kRxLastDesc) ? (RingEnd | DescOwn) : DescOwn;
-        opts2 = 0;
         addr = 0;
         
         /* As we don't support jumbo frames we consider fragmented packets as errors. */
@@ -1763,6 +2636,34 @@ UInt32 RTL8100::rxInterrupt(IONetworkInterface *interface, uint32_t maxCount, IO
         vlanTag = (descStatus2 & RxVlanTag) ? OSSwapInt16(descStatus2 & 0xffff) : 0;
         //DebugLog("rxInterrupt(): descStatus1=0x%x, descStatus2=0x%x, pktSize=%u\n", descStatus1, descStatus2, pktSize);
         
+        /* Drop unwanted frames right in the DMA buffer, which stays in the ring. */
+        if (rxFilterCount && !promiscusMode && rxFilterDrop((const UInt8 *)mbuf_data(bufPkt), pktSize, vlanTag)) {
+            opts1 |= kRxBufferPktSize;
+            droppedPkts++;
+            goto nextDesc;
+        }
+        /* Copy small frames into a right-sized mbuf and leave the buffer in the ring. */
+        if (pktSize < rxCopybreak) {
+            newPkt = allocatePacket(pktSize);
+            
+            if (newPkt) {
+                bcopy(mbuf_data(bufPkt), mbuf_data(newPkt), pktSize);
+                opts1 |= kRxBufferPktSize;
+                goto handOver;
+            }
+        }
+        /* Hand the filled buffer up the stack and replace it with one from the pool. */
+        if (rxPoolCount > 0) {
+            rxPoolCount--;
+            newPkt = bufPkt;
+            rxMbufArray[rxNextDescIndex] = rxPool[rxPoolCount].mbuf;
+            rxPool[rxPoolCount].mbuf = NULL;
+            opts1 |= (rxPool[rxPoolCount].length & 0x0000ffff);
+            addr = rxPool[rxPoolCount].phyAddr;
+            rxPoolStats.hits++;
+            goto handOver;
+        }
+        rxPoolStats.misses++;
         newPkt = replaceOrCopyPacket(&bufPkt, pktSize, &replaced);
         
         if (!newPkt) {
@@ -1788,29 +2689,368 @@ UInt32 RTL8100::rxInterrupt(IONetworkInterface *interface, uint32_t maxCount, IO
         } else {
             opts1 |= kRxBufferPktSize;
         }
-        getChecksumResult(newPkt, descStatus1, descStatus2);
+        
+    handOver:
+        /* Set the length first, as software checksum verification must only see the frame. */
+        mbuf_pkthdr_setlen(newPkt, pktSize);
+        mbuf_setlen(newPkt, pktSize);
+        
+        getChecksumResult<rev2>(newPkt, descStatus1, descStatus2);
         
         /* Also get the VLAN tag if there is any. */
         if (vlanTag)
             setVlanTag(newPkt, vlanTag);
         
-        mbuf_pkthdr_setlen(newPkt, pktSize);
-        mbuf_setlen(newPkt, pktSize);
-        interface->enqueueInputPacket(newPkt, pollQueue);
+        if (!rxCoalescing || !rxCoalesce(interface, newPkt, vlanTag, pollQueue))
+            interface->enqueueInputPacket(newPkt, pollQueue);
+        
         goodPkts++;
         
-        /* Finally update the descriptor and get the next one to examine. */
-    nextDesc:
-        if (addr)
-            desc->addr = OSSwapHostToLittleInt64(addr);
+        intrMod.rxPackets++;
+        intrMod.rxBytes += pktSize;
         
-        desc->opts2 = OSSwapHostToLittleInt32(opts2);
-        desc->opts1 = OSSwapHostToLittleInt32(opts1);
+        /* Finally record the descriptor's update and get the next one to examine. The
+         * descriptors are returned to the chip once their cache line is complete.
+         */
+    nextDesc:
+        rxRefill[rxNextDescIndex & kRxDescGroupMask].addr = addr;
+        rxRefill[rxNextDescIndex & kRxDescGroupMask].opts1 = opts1;
         
         ++rxNextDescIndex &= kRxDescMask;
         desc = &rxDescArray[rxNextDescIndex];
+        
+        if (!(rxNextDescIndex & kRxDescGroupMask))
+            rxReturnDescs(kRxDescGroupSize);
+    }
+    /* Pass the coalesced packets up the stack at the end of the batch. */
+    if (rxCoalescing)
+        rxCoalFlushAll(interface, pollQueue);
+    
+    /* Refill the buffer pool in bulk once it has been drained below the low watermark. */
+    if (rxPoolCount < kRxPoolLowWater)
+        rxPoolRefill(kRxPoolHighWater);
+    
+    return (goodPkts + droppedPkts);
+}
+
+/*
+ * Hands the count descriptors before rxNextDescIndex back to the chip, applying the
+ * updates recorded in rxRefill. Returning a whole cache line at once keeps the CPU from
+ * writing to the uncached descriptor line after each packet while the chip is using it.
+ * The descriptors of a group stay unowned by the chip until then, which is safe as the
+ * rest of the group lies ahead of the chip and has to be filled before it can wrap
+ * around. Each descriptor's opts1 is written last.
+ */
+inline void RTL8100::rxReturnDescs(UInt32 count)
+{
+    UInt32 index = (rxNextDescIndex - count) & kRxDescMask;
+    RtlDmaDesc *desc = &rxDescArray[index];
+    RtlRxRefill *refill = &rxRefill[index & kRxDescGroupMask];
+    UInt32 i;
+    
+    for (i = 0; i < count; i++, desc++, refill++) {
+        if (refill->addr)
+            desc->addr = OSSwapHostToLittleInt64(refill->addr);
+        
+        desc->opts2 = 0;
+        desc->opts1 = OSSwapHostToLittleInt32(refill->opts1);
     }
-    return goodPkts;
+}
+
+/*
+ * Receive coalescing stage between descriptor processing and the network stack.
+ *
+ * In-order TCP/IPv4 segments of the same flow, which passed hardware checksum
+ * validation, are chained to the flow's first segment. Only the first segment
+ * keeps its headers, whose length and acknowledgment fields are updated to
+ * cover the whole chain. Returns true if the packet has been consumed,
+ * otherwise the caller has to pass it up the stack itself. Segments of a
+ * tracked flow which can't be merged flush the flow first so that the stack
+ * always sees them in order.
+ */
+bool RTL8100::rxCoalesce(IONetworkInterface *interface, mbuf_t m, UInt16 vlanTag, IOMbufQueue *pollQueue)
+{
+    RtlRxCoalFlow *flow = NULL;
+    RtlRxCoalFlow *freeFlow = NULL;
+    struct ether_header *ethHdr;
+    struct ip *ipHdr, *headIpHdr;
+    struct tcphdr *tcpHdr, *headTcpHdr;
+    mbuf_csum_performed_flags_t performed;
+    UInt32 value;
+    UInt32 ipHdrLength, tcpHdrLength;
+    UInt32 ipLength, payload;
+    UInt32 i;
+    bool mergeable;
+    bool result = false;
+    
+    if (mbuf_len(m) < (ETHER_HDR_LEN + sizeof(struct ip)))
+        goto done;
+    
+    ethHdr = (struct ether_header *)mbuf_data(m);
+    ipHdr = (struct ip *)((UInt8 *)ethHdr + ETHER_HDR_LEN);
+    ipHdrLength = ipHdr->ip_hl << 2;
+    
+    if ((ethHdr->ether_type != htons(ETHERTYPE_IP)) || (ipHdr->ip_p != IPPROTO_TCP))
+        goto done;
+    
+    if (mbuf_len(m) < (ETHER_HDR_LEN + ipHdrLength + sizeof(struct tcphdr)))
+        goto done;
+    
+    tcpHdr = (struct tcphdr *)((UInt8 *)ipHdr + ipHdrLength);
+    tcpHdrLength = tcpHdr->th_off << 2;
+    ipLength = ntohs(ipHdr->ip_len);
+    
+    /* Look up the flow. */
+    for (i = 0; i < kRxCoalNumFlows; i++) {
+        if (!rxCoalFlows[i].head) {
+            if (!freeFlow)
+                freeFlow = &rxCoalFlows[i];
+            
+            continue;
+        }
+        if ((rxCoalFlows[i].srcPort == tcpHdr->th_sport) && (rxCoalFlows[i].dstPort == tcpHdr->th_dport) &&
+            (rxCoalFlows[i].srcAddr == ipHdr->ip_src.s_addr) && (rxCoalFlows[i].dstAddr == ipHdr->ip_dst.s_addr) &&
+            (rxCoalFlows[i].vlanTag == vlanTag)) {
+            flow = &rxCoalFlows[i];
+            break;
+        }
+    }
+    /* Only plain data segments with valid checksums and without IP options qualify. */
+    mbuf_get_csum_performed(m, &performed, &value);
+    
+    mergeable = ((performed & (MBUF_CSUM_DID_IP | MBUF_CSUM_IP_GOOD | MBUF_CSUM_DID_DATA)) == (MBUF_CSUM_DID_IP | MBUF_CSUM_IP_GOOD | MBUF_CSUM_DID_DATA)) &&
+                (ipHdrLength == sizeof(struct ip)) && !(ipHdr->ip_off & htons(IP_MF | IP_OFFMASK)) &&
+                ((tcpHdr->th_flags & ~TH_PUSH) == TH_ACK) && (tcpHdrLength >= sizeof(struct tcphdr)) &&
+                (mbuf_len(m) >= (ETHER_HDR_LEN + ipHdrLength + tcpHdrLength)) &&
+                (mbuf_pkthdr_len(m) == (ETHER_HDR_LEN + ipLength)) &&
+                (ipLength > (ipHdrLength + tcpHdrLength));
+    
+    payload = ipLength - ipHdrLength - tcpHdrLength;
+    
+    if (flow) {
+        headIpHdr = (struct ip *)((UInt8 *)mbuf_data(flow->head) + ETHER_HDR_LEN);
+        
+        /* A segment with a different TOS or TTL must not be merged, as its ECN bits would get lost. */
+        if (mergeable && (ntohl(tcpHdr->th_seq) == flow->nextSeq) && (tcpHdrLength == flow->tcpHdrLength) &&
+            (ipHdr->ip_tos == headIpHdr->ip_tos) && (ipHdr->ip_ttl == headIpHdr->ip_ttl) &&
+            (flow->numSegs < kRxCoalMaxSegs) && ((flow->ipLength + payload) <= kRxCoalMaxIPLength)) {
+            /* Take over the latest acknowledgment, window and options. */
+            headTcpHdr = (struct tcphdr *)((UInt8 *)headIpHdr + sizeof(struct ip));
+            headTcpHdr->th_ack = tcpHdr->th_ack;
+            headTcpHdr->th_win = tcpHdr->th_win;
+            headTcpHdr->th_flags |= (tcpHdr->th_flags & TH_PUSH);
+            
+            if (tcpHdrLength > sizeof(struct tcphdr))
+                bcopy((UInt8 *)tcpHdr + sizeof(struct tcphdr), (UInt8 *)headTcpHdr + sizeof(struct tcphdr), tcpHdrLength - sizeof(struct tcphdr));
+            
+            /* Strip the headers and append the payload to the chain. Only the head
+             * of the chain may carry a packet header.
+             */
+            mbuf_adj(m, ETHER_HDR_LEN + ipHdrLength + tcpHdrLength);
+            mbuf_setflags_mask(m, 0, MBUF_PKTHDR);
+            mbuf_concatenate(flow->tail, m);
+            
+            while (mbuf_next(flow->tail))
+                flow->tail = mbuf_next(flow->tail);
+            
+            flow->ipLength += payload;
+            flow->nextSeq += payload;
+            flow->numSegs++;
+            mbuf_pkthdr_setlen(flow->head, ETHER_HDR_LEN + flow->ipLength);
+            
+            /* The sender wants the data to be delivered now. */
+            if (tcpHdr->th_flags & TH_PUSH)
+                rxCoalFlush(interface, flow, pollQueue);
+            
+            result = true;
+            goto done;
+        }
+        rxCoalFlush(interface, flow, pollQueue);
+        freeFlow = flow;
+    }
+    if (!mergeable || (tcpHdr->th_flags & TH_PUSH))
+        goto done;
+    
+    /* Start a new flow, evicting one if the table is full. */
+    if (!freeFlow) {
+        freeFlow = &rxCoalFlows[rxCoalEvict];
+        rxCoalEvict = (rxCoalEvict + 1) % kRxCoalNumFlows;
+        rxCoalFlush(interface, freeFlow, pollQueue);
+    }
+    freeFlow->head = m;
+    freeFlow->tail = m;
+    
+    while (mbuf_next(freeFlow->tail))
+        freeFlow->tail = mbuf_next(freeFlow->tail);
+    
+    freeFlow->srcAddr = ipHdr->ip_src.s_addr;
+    freeFlow->dstAddr = ipHdr->ip_dst.s_addr;
+    freeFlow->srcPort = tcpHdr->th_sport;
+    freeFlow->dstPort = tcpHdr->th_dport;
+    freeFlow->nextSeq = ntohl(tcpHdr->th_seq) + payload;
+    freeFlow->ipLength = ipLength;
+    freeFlow->tcpHdrLength = tcpHdrLength;
+    freeFlow->vlanTag = vlanTag;
+    freeFlow->numSegs = 1;
+    result = true;
+    
+done:
+    return result;
+}
+
+/*
+ * Fixes up the IP header of a coalesced packet and passes it up the stack.
+ */
+void RTL8100::rxCoalFlush(IONetworkInterface *interface, RtlRxCoalFlow *flow, IOMbufQueue *pollQueue)
+{
+    struct ip *ipHdr;
+    
+    if (!flow->head)
+        return;
+    
+    if (flow->numSegs > 1) {
+        ipHdr = (struct ip *)((UInt8 *)mbuf_data(flow->head) + ETHER_HDR_LEN);
+        ipHdr->ip_len = htons((UInt16)flow->ipLength);
+        ipHdr->ip_sum = 0;
+        ipHdr->ip_sum = ipHeaderChecksum(ipHdr);
+    }
+    interface->enqueueInputPacket(flow->head, pollQueue);
+    
+    flow->head = NULL;
+    flow->tail = NULL;
+    flow->numSegs = 0;
+}
+
+void RTL8100::rxCoalFlushAll(IONetworkInterface *interface, IOMbufQueue *pollQueue)
+{
+    UInt32 i;
+    
+    for (i = 0; i < kRxCoalNumFlows; i++)
+        rxCoalFlush(interface, &rxCoalFlows[i], pollQueue);
+}
+
+/*
+ * Builds the early rx filter program from the driver's configuration. The rules
+ * are ordered so that the ones protecting against floods come first. The
+ * multicast rule follows the list set by setMulticastList() at runtime.
+ */
+void RTL8100::rxFilterCompile(OSDictionary *config)
+{
+    RtlRxFilterRule *rule;
+    OSNumber *num;
+    OSBoolean *exact;
+    OSArray *array;
+    UInt32 i, value;
+    
+    rxFilterCount = 0;
+    bzero(rxFilterRules, sizeof(rxFilterRules));
+    bzero(rxFilterVlans, sizeof(rxFilterVlans));
+    
+    if (!config)
+        goto done;
+    
+    num = OSDynamicCast(OSNumber, config->getObject(kRxFilterBcastLimitName));
+    
+    if (num && (value = num->unsigned32BitValue())) {
+        rule = &rxFilterRules[rxFilterCount++];
+        rule->op = kRxFilterOpBroadcastLimit;
+        rule->arg = value;
+    }
+    exact = OSDynamicCast(OSBoolean, config->getObject(kRxFilterMcExactName));
+    
+    if (exact && exact->getValue()) {
+        rule = &rxFilterRules[rxFilterCount++];
+        rule->op = kRxFilterOpMulticastExact;
+    }
+    array = OSDynamicCast(OSArray, config->getObject(kRxFilterVlansName));
+    
+    if (array && array->getCount()) {
+        for (i = 0; i < array->getCount(); i++) {
+            if ((num = OSDynamicCast(OSNumber, array->getObject(i))) && ((value = num->unsigned32BitValue()) < kRxFilterNumVlans))
+                rxFilterVlans[value >> 5] |= (1U << (value & 0x1f));
+        }
+        rule = &rxFilterRules[rxFilterCount++];
+        rule->op = kRxFilterOpVlanAllow;
+    }
+    array = OSDynamicCast(OSArray, config->getObject(kRxFilterEtherTypesName));
+    
+    if (array) {
+        for (i = 0; (i < array->getCount()) && (rxFilterCount < kRxFilterMaxRules); i++) {
+            if ((num = OSDynamicCast(OSNumber, array->getObject(i)))) {
+                rule = &rxFilterRules[rxFilterCount++];
+                rule->op = kRxFilterOpEtherTypeDrop;
+                rule->arg = htons(num->unsigned16BitValue());
+            }
+        }
+    }
+    
+done:
+    IOLog("Ethernet [RealtekRTL8100]: Early rx filter with %u rules.\n", rxFilterCount);
+}
+
+/*
+ * Runs the early rx filter program on a received frame, which is still in its DMA
+ * buffer. vlanTag is the tag stripped by the chip, if any. Returns true if the frame
+ * has to be dropped, in which case the hit counter of the rule that matched has
+ * been updated.
+ */
+inline bool RTL8100::rxFilterDrop(const UInt8 *frame, UInt32 length, UInt16 vlanTag)
+{
+    RtlRxFilterRule *rule = &rxFilterRules[0];
+    UInt32 etherType;
+    UInt32 vlanId;
+    UInt32 i;
+    bool broadcast;
+    bool drop = false;
+    
+    if (length < ETHER_HDR_LEN)
+        goto done;
+    
+    broadcast = ((*(const UInt32 *)frame == 0xffffffff) && (*(const UInt16 *)(frame + 4) == 0xffff));
+    etherType = *(const UInt16 *)(frame + 12);
+    
+    /* Frames with an inline tag carry the real EtherType behind it. */
+    if ((etherType == htons(ETHERTYPE_VLAN)) && (length >= ETHER_HDR_LEN + 4)) {
+        vlanTag = ntohs(*(const UInt16 *)(frame + 14));
+        etherType = *(const UInt16 *)(frame + 16);
+    }
+    /* Priority tagged frames (VLAN ID 0) belong to the untagged network. */
+    vlanId = vlanTag & 0x0fff;
+    
+    for (i = 0; i < rxFilterCount; i++, rule++) {
+        switch (rule->op) {
+            case kRxFilterOpBroadcastLimit:
+                drop = (broadcast && (++rxFilterBcastCount > rule->arg));
+                break;
+                
+            case kRxFilterOpMulticastExact:
+                drop = ((frame[0] & 0x01) && !broadcast && rxFilterMcExact && !mcTableLookup(rxFilterMcTable, frame));
+                
+                /* Tell hash collisions from frames let through by the all-multicast fallback. */
+                if (drop) {
+                    if (rxFilterMcFallback)
+                        rxFilterMcFallbackDrops++;
+                    else
+                        rxFilterMcHashDrops++;
+                }
+                break;
+                
+            case kRxFilterOpVlanAllow:
+                drop = (vlanId && !(rxFilterVlans[vlanId >> 5] & (1U << (vlanId & 0x1f))));
+                break;
+                
+            case kRxFilterOpEtherTypeDrop:
+                drop = (etherType == rule->arg);
+                break;
+        }
+        if (drop) {
+            rule->hits++;
+            break;
+        }
+    }
+    
+done:
+    return drop;
 }
 
 /*
@@ -1818,8 +3058,8 @@ UInt32 RTL8100::rxInterrupt(IONetworkInterface *interface, uint32_t maxCount, IO
  */
 void RTL8100::interruptOccurredPoll(OSObject *client, IOInterruptEventSource *src, int count)
 {
-    UInt32 packets;
-    
+    ProfStart(start);
+    UInt32 packets = 0;
     UInt16 status;
     
     WriteReg16(IntrMask, 0x0000);
@@ -1833,6 +3073,9 @@ void RTL8100::interruptOccurredPoll(OSObject *client, IOInterruptEventSource *sr
         pciErrorInterrupt();
         goto done;
     }
+    if ((status & LinkChg) && linkChgIntr)
+        checkLinkStatus();
+    
     if (!polling) {
         /* Rx interrupt */
         if (status & (RxOK | RxDescUnavail | RxFIFOOver)) {
@@ -1849,6 +3092,8 @@ void RTL8100::interruptOccurredPoll(OSObject *client, IOInterruptEventSource *sr
 done:
     WriteReg16(IntrStatus, status);
     WriteReg16(IntrMask, intrMask);
+    
+    ProfEnd(kProfInterrupt, start, packets);
 }
 
 /*
@@ -1856,7 +3101,8 @@ done:
  */
 void RTL8100::interruptOccurred(OSObject *client, IOInterruptEventSource *src, int count)
 {
-    UInt32 packets;
+    ProfStart(start);
+    UInt32 packets = 0;
     UInt16 status;
     
 	WriteReg16(IntrMask, 0x0000);
@@ -1869,12 +3115,23 @@ void RTL8100::interruptOccurred(OSObject *client, IOInterruptEventSource *src, i
     if (status & SYSErr)
         pciErrorInterrupt();
     
-    /* Rx interrupt */
-    if (status & (RxOK | RxDescUnavail | RxFIFOOver)) {
-        packets = rxInterrupt(netif, kNumRxDesc, NULL, NULL);
+    if ((status & LinkChg) && linkChgIntr)
+        checkLinkStatus();
+    
+    /* Rx interrupt. A pass which uses up its budget is continued by rxBudgetOccurred()
+     * while the rx interrupts stay masked, so that tx completions and the statistics
+     * don't have to wait until the whole ring has been processed.
+     */
+    if ((status & (RxOK | RxDescUnavail | RxFIFOOver)) && !rxBudgetPending) {
+        packets = rxInterrupt(netif, rxBudget, NULL, NULL);
     
         if (packets)
             netif->flushInputQueue();
+        
+        if (packets >= rxBudget) {
+            rxBudgetPending = true;
+            rxBudgetSource->interruptOccurred(NULL, NULL, 0);
+        }
     }
 
     /* Tx interrupt */
@@ -1885,9 +3142,210 @@ void RTL8100::interruptOccurred(OSObject *client, IOInterruptEventSource *src, i
     if (needsUpdate && !(ReadReg32(CounterAddrLow) & CounterDump))
         updateStatitics();
     
+    if (adaptiveIntrMit)
+        intrModSample();
+    
 done:
     WriteReg16(IntrStatus, status);
-	WriteReg16(IntrMask, intrMask);
+	WriteReg16(IntrMask, (rxBudgetPending) ? (intrMask & ~kRxIntrMask) : intrMask);
+    
+    ProfEnd(kProfInterrupt, start, packets);
+}
+
+/*
+ * Continues the receive pass of interruptOccurred() with another budget.
+ * Each pass reclaims completed tx descriptors too. Once a pass leaves some
+ * of its budget unused, the ring has been drained and the rx interrupts are
+ * unmasked again. Events which have arrived in the meantime are still latched
+ * in IntrStatus and will trigger an interrupt right away.
+ */
+void RTL8100::rxBudgetOccurred(OSObject *client, IOInterruptEventSource *src, int count)
+{
+    UInt32 packets;
+    
+    if (!(isEnabled && rxBudgetPending))
+        return;
+    
+    packets = rxInterrupt(netif, rxBudget, NULL, NULL);
+    
+    if (packets)
+        netif->flushInputQueue();
+    
+    txInterrupt();
+    
+    if (packets >= rxBudget) {
+        rxBudgetSource->interruptOccurred(NULL, NULL, 0);
+    } else {
+        rxBudgetPending = false;
+        WriteReg16(IntrMask, intrMask);
+    }
+}
+
+/*
+ * Restarts the adaptive interrupt moderation engine with the lowest
+ * latency profile. Called whenever the chip is (re)started.
+ */
+void RTL8100::intrModReset()
+{
+    UInt64 uptime;
+    
+    clock_get_uptime(&uptime);
+    absolutetime_to_nanoseconds(uptime, &intrMod.lastSample);
+    intrMod.lastRxPackets = intrMod.rxPackets;
+    intrMod.lastRxBytes = intrMod.rxBytes;
+    intrMod.lastTxPackets = intrMod.txPackets;
+    intrMod.lastTxBytes = intrMod.txBytes;
+    intrMod.profile = 0;
+    intrMod.candidate = 0;
+    intrMod.candidateCount = 0;
+}
+
+/*
+ * Takes a sample of the packet and byte rates once per kIntrModSampleMS and
+ * reprograms the IntrMitigate register when the engine selects a new profile.
+ * Called from the interrupt handler and from the watchdog timer so that an
+ * idle link returns to the lowest latency profile too.
+ */
+void RTL8100::intrModSample()
+{
+    UInt64 uptime, now, elapsed;
+    UInt32 oldProfile = intrMod.profile;
+    
+    clock_get_uptime(&uptime);
+    absolutetime_to_nanoseconds(uptime, &now);
+    elapsed = now - intrMod.lastSample;
+    
+    if (elapsed < (kIntrModSampleMS * 1000000ULL))
+        return;
+    
+    intrModSelectProfile(&intrMod, intrMod.rxPackets - intrMod.lastRxPackets, intrMod.rxBytes - intrMod.lastRxBytes,
+                         intrMod.txPackets - intrMod.lastTxPackets, intrMod.txBytes - intrMod.lastTxBytes, elapsed, speed);
+    
+    intrMod.lastRxPackets = intrMod.rxPackets;
+    intrMod.lastRxBytes = intrMod.rxBytes;
+    intrMod.lastTxPackets = intrMod.txPackets;
+    intrMod.lastTxBytes = intrMod.txBytes;
+    intrMod.lastSample = now;
+    
+    if (intrMod.profile != oldProfile) {
+        WriteReg16(IntrMitigate, intrModProfiles[intrMod.profile].intrMitigate);
+        DebugLog("Ethernet [RealtekRTL8100]: Interrupt moderation profile %u (0x%04x).\n", intrMod.profile, intrModProfiles[intrMod.profile].intrMitigate);
+    }
+}
+
+/*
+ * Restarts the packet polling parameter tuning with the first profile.
+ * Called by setLinkUp() before the parameters are passed to the interface.
+ */
+void RTL8100::pollTuneReset()
+{
+    UInt64 uptime;
+    
+    clock_get_uptime(&uptime);
+    absolutetime_to_nanoseconds(uptime, &pollTune.lastSample);
+    pollTune.lastPackets = intrMod.rxPackets;
+    pollTune.lastBytes = intrMod.rxBytes;
+    pollTune.lastPasses = pollTune.rxPasses;
+    pollTune.rxMaxBatch = 0;
+    pollTune.load = 0;
+    pollTune.occupancy = 0;
+    pollTune.burstiness = 0;
+    pollTune.profile = 0;
+    pollTune.candidate = 0;
+    pollTune.candidateCount = 0;
+    pollTune.reason = kPollTuneReasonIdle;
+}
+
+/*
+ * Takes a sample of the receive traffic once per kPollTuneSampleMS and passes
+ * new polling parameters to the interface when the tuning selects another
+ * profile. Called from rxInterrupt() and from the watchdog timer so that an
+ * idle link returns to the first profile too.
+ */
+void RTL8100::pollTuneSample()
+{
+    UInt64 uptime, now, elapsed;
+    UInt32 oldProfile = pollTune.profile;
+    
+    clock_get_uptime(&uptime);
+    absolutetime_to_nanoseconds(uptime, &now);
+    elapsed = now - pollTune.lastSample;
+    
+    if (elapsed < (kPollTuneSampleMS * 1000000ULL))
+        return;
+    
+    pollTuneSelectProfile(&pollTune, intrMod.rxPackets - pollTune.lastPackets, intrMod.rxBytes - pollTune.lastBytes,
+                          pollTune.rxPasses - pollTune.lastPasses, pollTune.rxMaxBatch, elapsed, speed);
+    
+    pollTune.lastPackets = intrMod.rxPackets;
+    pollTune.lastBytes = intrMod.rxBytes;
+    pollTune.lastPasses = pollTune.rxPasses;
+    pollTune.rxMaxBatch = 0;
+    pollTune.lastSample = now;
+    
+    if (pollTune.profile != oldProfile) {
+        pollTuneGetParams(&pollTuneProfiles[pollTune.profile], &pollParams);
+        netif->setPacketPollingParameters(&pollParams, 0);
+        pollTune.changes++;
+        DebugLog("Ethernet [RealtekRTL8100]: Polling profile %u (%s).\n", pollTune.profile, pollTuneReasons[pollTune.reason]);
+    }
+}
+
+void RTL8100::pollTuneUpdateStats()
+{
+    OSDictionary *dict = OSDictionary::withCapacity(12);
+    OSNumber *num;
+    OSString *str;
+    
+    if (!dict)
+        return;
+    
+    if ((num = OSNumber::withNumber(pollTune.profile, 32))) {
+        dict->setObject("Profile", num);
+        num->release();
+    }
+    if ((str = OSString::withCString(pollTuneReasons[pollTune.reason]))) {
+        dict->setObject("Reason", str);
+        str->release();
+    }
+    if ((num = OSNumber::withNumber(pollTune.load, 32))) {
+        dict->setObject("Load", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(pollTune.occupancy, 32))) {
+        dict->setObject("Occupancy", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(pollTune.burstiness, 32))) {
+        dict->setObject("Burstiness", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(pollTune.changes, 32))) {
+        dict->setObject("Changes", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(pollParams.lowThresholdPackets, 32))) {
+        dict->setObject("LowThresholdPackets", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(pollParams.highThresholdPackets, 32))) {
+        dict->setObject("HighThresholdPackets", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(pollParams.lowThresholdBytes, 32))) {
+        dict->setObject("LowThresholdBytes", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(pollParams.highThresholdBytes, 32))) {
+        dict->setObject("HighThresholdBytes", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(pollParams.pollIntervalTime / 1000, 64))) {
+        dict->setObject("PollIntervalUs", num);
+        num->release();
+    }
+    setProperty(kPollTuneStatsName, dict);
+    dict->release();
 }
 
 /*
@@ -1909,7 +3367,9 @@ bool RTL8100::checkForDeadlock()
 {
     bool deadlock = false;
     
-    if ((txDescDoneCount == txDescDoneLast) && (txNumFreeDesc < kNumTxDesc)) {
+    /* Each ring is checked on its own, so that traffic on one ring can't hide a stall of the other. */
+    if (((txDescDoneCount[kTxQueueNormal] == txDescDoneLast[kTxQueueNormal]) && (txNextDescIndex != txDirtyDescIndex)) ||
+        ((txDescDoneCount[kTxQueueHigh] == txDescDoneLast[kTxQueueHigh]) && (txHiNextDescIndex != txHiDirtyDescIndex))) {
         if (++deadlockWarn == kTxCheckTreshhold) {
             /* Some members of the RTL8100 family seem to be prone to lose transmitter rinterrupts.
              * In order to avoid false positives when trying to detect transmitter deadlocks, check
@@ -2013,10 +3473,11 @@ void RTL8100::pollInputPackets(IONetworkInterface *interface, uint32_t maxCount,
 /*
  * Get command bits for TCP Segmentation Offload operations using TCP/IPv4.
  */
-void RTL8100::getTso4Command(UInt32 *cmd1, UInt32 *cmd2, UInt32 mssValue, mbuf_tso_request_flags_t tsoFlags)
+template <bool rev2>
+void RTL8100::getTso4Command(UInt32 *cmd1, UInt32 *cmd2, UInt32 mssValue, UInt32 l4Offset)
 {
-    if (revision2) {
-        *cmd1 = (GiantSendv4 | (kMinL4HdrOffsetV4 << GSendL4OffShift));
+    if (rev2) {
+        *cmd1 = (GiantSendv4 | ((l4Offset & GSendL4OffMask) << GSendL4OffShift));
         *cmd2 = ((mssValue & MSSMask) << MSSShift_C);
     } else {
         *cmd1 = (LargeSend |((mssValue & MSSMask) << MSSShift));
@@ -2026,18 +3487,142 @@ void RTL8100::getTso4Command(UInt32 *cmd1, UInt32 *cmd2, UInt32 mssValue, mbuf_t
 /*
  * Get command bits for TCP Segmentation Offload operations using TCP/IPv6.
  */
-void RTL8100::getTso6Command(UInt32 *cmd1, UInt32 *cmd2, UInt32 mssValue, mbuf_tso_request_flags_t tsoFlags)
+void RTL8100::getTso6Command(UInt32 *cmd1, UInt32 *cmd2, UInt32 mssValue, UInt32 l4Offset)
 {
-    *cmd1 = (GiantSendv6 | (kMinL4HdrOffsetV6 << GSendL4OffShift));
+    *cmd1 = (GiantSendv6 | ((l4Offset & GSendL4OffMask) << GSendL4OffShift));
     *cmd2 = ((mssValue & MSSMask) << MSSShift_C);
 }
 
+/*
+ * Software TCP segmentation, used for TCP/IPv6 on chips without GiantSend support
+ * for IPv6 and for header layouts GiantSend can't handle. The packet is split into
+ * MSS-sized packets which share one header template. The TCP checksum of each
+ * segment is derived incrementally from the checksum of the template. Consumes the
+ * packet and returns the list of segments linked by their nextpkt field or NULL
+ * on failure.
+ */
+mbuf_t RTL8100::txSegmentTso(mbuf_t m, UInt32 mssValue, RtlHdrInfo *hdrInfo)
+{
+    UInt8 hdr[kMaxTsoHdrLen];
+    UInt32 l3Offset = hdrInfo->l3Offset;
+    UInt32 l4Offset = hdrInfo->l4Offset;
+    struct ip *ipHdr = (struct ip *)(hdr + l3Offset);
+    struct ip6_hdr *ip6Hdr = (struct ip6_hdr *)(hdr + l3Offset);
+    struct tcphdr *tcpHdr = (struct tcphdr *)(hdr + l4Offset);
+    struct tcphdr *segTcpHdr;
+    mbuf_t head = NULL;
+    mbuf_t tail = NULL;
+    mbuf_t seg;
+    UInt8 *data;
+    UInt32 pktLen = (UInt32)mbuf_pkthdr_len(m);
+    UInt32 hdrLen, tcpHdrLen, l3Len;
+    UInt32 offset, segLen;
+    UInt32 baseSum, sum;
+    UInt32 seq, seqNet;
+    UInt32 vlanTag;
+    UInt16 ipId = 0;
+    UInt8 flags, segFlags;
+    bool hasVlan = getVlanTagDemand(m, &vlanTag);
+    
+    if (((l4Offset + sizeof(struct tcphdr)) > kMaxTsoHdrLen) ||
+        mbuf_copydata(m, 0, l4Offset + sizeof(struct tcphdr), hdr))
+        goto error;
+    
+    tcpHdrLen = tcpHdr->th_off << 2;
+    hdrLen = l4Offset + tcpHdrLen;
+    l3Len = l4Offset - l3Offset;
+    
+    if ((tcpHdrLen < sizeof(struct tcphdr)) || (hdrLen > kMaxTsoHdrLen) || (pktLen <= hdrLen) ||
+        !mssValue || ((hdrLen + mssValue) > MCLBYTES) || mbuf_copydata(m, 0, hdrLen, hdr))
+        goto error;
+    
+    /* Prepare the template and get the checksum of its invariant part. */
+    seq = ntohl(tcpHdr->th_seq);
+    flags = tcpHdr->th_flags;
+    tcpHdr->th_seq = 0;
+    tcpHdr->th_flags = 0;
+    tcpHdr->th_sum = 0;
+    
+    if (hdrInfo->isIPv6) {
+        baseSum = csumPartial((UInt8 *)&ip6Hdr->ip6_src, 2 * sizeof(struct in6_addr), htons(IPPROTO_TCP));
+    } else {
+        ipId = ntohs(ipHdr->ip_id);
+        baseSum = csumPartial((UInt8 *)&ipHdr->ip_src, 2 * sizeof(struct in_addr), htons(IPPROTO_TCP));
+    }
+    baseSum = csumPartial((UInt8 *)tcpHdr, tcpHdrLen, baseSum);
+    
+    for (offset = hdrLen; offset < pktLen; offset += segLen) {
+        segLen = ((pktLen - offset) < mssValue) ? (pktLen - offset) : mssValue;
+        seg = allocatePacket(hdrLen + segLen);
+        
+        if (!seg)
+            goto error;
+        
+        if (tail)
+            mbuf_setnextpkt(tail, seg);
+        else
+            head = seg;
+        
+        tail = seg;
+        
+        data = (UInt8 *)mbuf_data(seg);
+        bcopy(hdr, data, hdrLen);
+        
+        if (mbuf_copydata(m, offset, segLen, data + hdrLen))
+            goto error;
+        
+        /* FIN and PSH belong to the last segment, CWR to the first one only. */
+        segFlags = flags;
+        
+        if (offset != hdrLen)
+            segFlags &= ~TH_CWR;
+        
+        if ((offset + segLen) < pktLen)
+            segFlags &= ~(TH_FIN | TH_PUSH);
+        
+        if (hdrInfo->isIPv6) {
+            ((struct ip6_hdr *)(data + l3Offset))->ip6_plen = htons((UInt16)(l3Len - sizeof(struct ip6_hdr) + tcpHdrLen + segLen));
+        } else {
+            ((struct ip *)(data + l3Offset))->ip_len = htons((UInt16)(l3Len + tcpHdrLen + segLen));
+            ((struct ip *)(data + l3Offset))->ip_id = htons(ipId++);
+            ((struct ip *)(data + l3Offset))->ip_sum = 0;
+            ((struct ip *)(data + l3Offset))->ip_sum = ipHeaderChecksum((struct ip *)(data + l3Offset));
+        }
+        seqNet = htonl(seq + (offset - hdrLen));
+        segTcpHdr = (struct tcphdr *)(data + l4Offset);
+        segTcpHdr->th_seq = seqNet;
+        segTcpHdr->th_flags = segFlags;
+        
+        sum = baseSum + htons((UInt16)(tcpHdrLen + segLen)) + (seqNet & 0xffff) + (seqNet >> 16) + htons(segFlags);
+        sum = csumPartial(data + hdrLen, segLen, sum);
+        segTcpHdr->th_sum = ~csumFold(sum);
+        
+        if (hasVlan)
+            setVlanTag(seg, vlanTag);
+    }
+    freePacket(m);
+    
+done:
+    return head;
+    
+error:
+    DebugLog("Ethernet [RealtekRTL8100]: Software TSO failed. Dropping packet.\n");
+    
+    if (head) {
+        mbuf_freem_list(head);
+        head = NULL;
+    }
+    freePacket(m);
+    goto done;
+}
+
 /*
  * Get command bits for TCP/UDP/IPv4 checksum offload operations.
  */
-void RTL8100::getChecksumCommand(UInt32 *cmd1, UInt32 *cmd2, mbuf_csum_request_flags_t checksums)
+template <bool rev2>
+void RTL8100::getChecksumCommand(UInt32 *cmd1, UInt32 *cmd2, mbuf_csum_request_flags_t checksums, UInt32 l4Offset)
 {
-    if (revision2) {
+    if (rev2) {
         if (checksums & kChecksumTCP)
             *cmd2 = (TxIPCS_C | TxTCPCS_C);
         else if (checksums & kChecksumUDP)
@@ -2045,9 +3630,9 @@ void RTL8100::getChecksumCommand(UInt32 *cmd1, UInt32 *cmd2, mbuf_csum_request_f
         else if (checksums & kChecksumIP)
             *cmd2 = TxIPCS_C;
         else if (checksums & kChecksumTCPIPv6)
-            *cmd2 = (TxTCPCS_C | TxIPV6F_C | ((kMinL4HdrOffsetV6 & L4OffMask) << MSSShift_C));
+            *cmd2 = (TxTCPCS_C | TxIPV6F_C | ((l4Offset & L4OffMask) << MSSShift_C));
         else if (checksums & kChecksumUDPIPv6)
-            *cmd2 = (TxUDPCS_C | TxIPV6F_C | ((kMinL4HdrOffsetV6 & L4OffMask) << MSSShift_C));
+            *cmd2 = (TxUDPCS_C | TxIPV6F_C | ((l4Offset & L4OffMask) << MSSShift_C));
     } else {
         /* Setup the checksum command bits. */
         if (checksums & kChecksumTCP)
@@ -2061,14 +3646,15 @@ void RTL8100::getChecksumCommand(UInt32 *cmd1, UInt32 *cmd2, mbuf_csum_request_f
 
 /*
  * Get result of TCP/UDP/IPv4 checksum validation done in hardware.
- * In case hardware checksum validation failed, we tread the packet as 
- * uncheck and let the network stack perform ckecksum validation in
- * software as hardware checksum validation may produce false negatives
- * sometimes.
+ * In case hardware checksum validation failed, the checksums are verified
+ * in software as hardware checksum validation may produce false negatives
+ * sometimes. Packets which fail again are passed up unchecked so that the
+ * network stack makes the final decision.
  */
 
 #ifdef DEBUG
 
+template <bool rev2>
 void RTL8100::getChecksumResult(mbuf_t m, UInt32 status1, UInt32 status2)
 {
     UInt32 resultMask = 0;
@@ -2076,7 +3662,7 @@ void RTL8100::getChecksumResult(mbuf_t m, UInt32 status1, UInt32 status2)
     UInt32 pktType = (status1 & RxProtoMask);
     
     /* Get the result of the checksum calculation and store it in the packet. */
-    if (revision2) {
+    if (rev2) {
         if (pktType == RxTCPT) {
             /* TCP packet */
             if (status2 & RxV4F) {
@@ -2115,8 +3701,14 @@ void RTL8100::getChecksumResult(mbuf_t m, UInt32 status1, UInt32 status2)
             validMask = (status1 & RxIPF) ? 0 : kChecksumIP;
         }
     }
-    if (validMask != resultMask)
+    if (validMask != resultMask) {
         IOLog("Ethernet [RealtekRTL8100]: checksums applied: 0x%x, checksums valid: 0x%x\n", resultMask, validMask);
+        
+        /* Report what software verification found, like the release build does. */
+        resultMask = validMask = rxSoftwareChecksum(m);
+        
+        IOLog("Ethernet [RealtekRTL8100]: checksums valid after software verification: 0x%x\n", validMask);
+    }
     
     if (validMask)
         setChecksumResult(m, kChecksumFamilyTCPIP, resultMask, validMask);
@@ -2124,12 +3716,13 @@ void RTL8100::getChecksumResult(mbuf_t m, UInt32 status1, UInt32 status2)
 
 #else
 
+template <bool rev2>
 void RTL8100::getChecksumResult(mbuf_t m, UInt32 status1, UInt32 status2)
 {
     UInt32 resultMask = 0;
     UInt32 pktType = (status1 & RxProtoMask);
     
-    if (revision2) {
+    if (rev2) {
         /* Get the result of the checksum calculation and store it in the packet. */
         if (pktType == RxTCPT) {
             /* TCP packet */
@@ -2155,6 +3748,10 @@ void RTL8100::getChecksumResult(mbuf_t m, UInt32 status1, UInt32 status2)
         else if (pktType == RxProtoIP)
             resultMask = (status1 & RxIPF) ? 0 : kChecksumIP;                    /* IP packet */
     }
+    /* Give packets flagged by the hardware a second chance. */
+    if (!resultMask && (status1 & (RxIPF | RxTCPF | RxUDPF)))
+        resultMask = rxSoftwareChecksum(m);
+    
     if (resultMask)
         setChecksumResult(m, kChecksumFamilyTCPIP, resultMask, resultMask);
 }
@@ -2263,12 +3860,14 @@ void RTL8100::setLinkUp(UInt8 linkState)
             pollParams.highThresholdBytes = 0x1800;
             pollParams.pollIntervalTime = 1000000;  /* 1ms */
         } else {
-            pollParams.lowThresholdPackets = 10;
-            pollParams.highThresholdPackets = 40;
-            pollParams.lowThresholdBytes = 0x1000;
-            pollParams.highThresholdBytes = 0x10000;
-            pollParams.pollIntervalTime = 1000000;  /* 1ms */
+            /* At 100 Mbit they start with the tuning's first profile. */
+            pollTuneGetParams(&pollTuneProfiles[0], &pollParams);
         }
+        pollTuning = (adaptivePoll && (speed == SPEED_100));
+        
+        if (pollTuning)
+            pollTuneReset();
+        
         netif->setPacketPollingParameters(&pollParams, 0);
         DebugLog("Ethernet [RealtekRTL8100]: pollIntervalTime: %lluus\n", (pollParams.pollIntervalTime / 1000));
     }
@@ -2286,6 +3885,7 @@ void RTL8100::setLinkDown()
 {
     deadlockWarn = 0;
     needsUpdate = false;
+    pollTuning = false;
     
     /* Stop output thread and flush output queue. */
     netif->stopOutputThread();
@@ -2972,6 +4572,21 @@ bool RTL8100::initRTL8100()
     /* Setup the interrupt masks for interrupt driven and polled mode. */
     intrMaskRxTx = (SYSErr | RxDescUnavail | TxErr | TxOK | RxErr | RxOK);
     intrMaskPoll = SYSErr;
+    
+    /* Use the link change interrupt on all but the early family members. */
+    switch (tp->mcfg) {
+        case CFG_METHOD_1:
+        case CFG_METHOD_2:
+        case CFG_METHOD_3:
+            linkChgIntr = false;
+            break;
+            
+        default:
+            linkChgIntr = true;
+            intrMaskRxTx |= LinkChg;
+            intrMaskPoll |= LinkChg;
+            break;
+    }
     intrMask = intrMaskRxTx;
 
     /* Get the RxConfig parameters. */
@@ -3261,6 +4876,7 @@ void RTL8100::enableRTL8100()
 	rtl8101_dsm(tp, DSM_IF_UP);
 
     setPhyMedium();
+    updatePhyMcuStats();
 }
 
 void RTL8100::disableRTL8100()
@@ -3279,14 +4895,144 @@ void RTL8100::disableRTL8100()
 	powerdownPLL();
     rtl8101_set_bios_setting(tp);
     
-    if (linkUp) {
-        linkUp = false;
-        setLinkStatus(kIONetworkLinkValid);
-        IOLog("Ethernet [RealtekRTL8100]: Link down on en%u\n", netif->getUnitNumber());
+    if (linkUp) {
+        linkUp = false;
+        setLinkStatus(kIONetworkLinkValid);
+        IOLog("Ethernet [RealtekRTL8100]: Link down on en%u\n", netif->getUnitNumber());
+    }
+
+}
+
+/*
+ * Publishes how often the PHY patch download has been performed or skipped
+ * and the time saved by skipping it. The time saved is estimated using the
+ * duration of the last download.
+ */
+void RTL8100::updatePhyMcuStats()
+{
+    struct rtl8101_private *tp = &linuxData;
+    OSDictionary *dict = OSDictionary::withCapacity(4);
+    OSNumber *num;
+    
+    if (!dict)
+        return;
+    
+    if ((num = OSNumber::withNumber(tp->phy_mcu_load_count, 32))) {
+        dict->setObject("Loads", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(tp->phy_mcu_skip_count, 32))) {
+        dict->setObject("Skips", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(tp->phy_mcu_load_time / 1000, 64))) {
+        dict->setObject("LoadTimeUs", num);
+        num->release();
+    }
+    if ((num = OSNumber::withNumber(tp->phy_mcu_time_saved / 1000, 64))) {
+        dict->setObject("TimeSavedUs", num);
+        num->release();
+    }
+    setProperty(kPhyMcuStatsName, dict);
+    dict->release();
+}
+
+/* Publishes the completion latency histograms of the indirect register accessors.
+ * Bucket n counts accesses which completed after 2^n to 2^(n+1) - 1 microseconds.
+ */
+void RTL8100::updateAccessStats()
+{
+    static const char *accessNames[RTL_ACCESS_COUNT] = { "MDIO", "EPHY", "ERI", "PHYIO" };
+    OSDictionary *dict = OSDictionary::withCapacity(RTL_ACCESS_COUNT);
+    OSDictionary *entry;
+    OSArray *hist;
+    OSNumber *num;
+    UInt32 i, j;
+    
+    if (!dict)
+        return;
+    
+    for (i = 0; i < RTL_ACCESS_COUNT; i++) {
+        if (!(entry = OSDictionary::withCapacity(2)))
+            continue;
+        
+        if ((hist = OSArray::withCapacity(RTL_ACCESS_HIST_BUCKETS))) {
+            for (j = 0; j < RTL_ACCESS_HIST_BUCKETS; j++) {
+                if ((num = OSNumber::withNumber(rtl8101_access_stats[i].hist[j], 32))) {
+                    hist->setObject(num);
+                    num->release();
+                }
+            }
+            entry->setObject("Histogram", hist);
+            hist->release();
+        }
+        if ((num = OSNumber::withNumber(rtl8101_access_stats[i].timeouts, 32))) {
+            entry->setObject("Timeouts", num);
+            num->release();
+        }
+        dict->setObject(accessNames[i], entry);
+        entry->release();
+    }
+    setProperty(kAccessStatsName, dict);
+    dict->release();
+}
+
+#if ENABLE_PROFILER
+
+/* Publishes the hot path profiles next to the ethernet statistics. */
+void RTL8100::updateProfStats()
+{
+    static const char *pathNames[kProfCount] = { "InterruptOccurred", "RxInterrupt", "TxInterrupt", "OutputStart" };
+    OSDictionary *dict = OSDictionary::withCapacity(kProfCount);
+    OSDictionary *entry;
+    OSArray *hist;
+    OSNumber *num;
+    UInt32 i, j;
+    
+    if (!dict)
+        return;
+    
+    for (i = 0; i < kProfCount; i++) {
+        if (!(entry = OSDictionary::withCapacity(4)))
+            continue;
+        
+        if ((num = OSNumber::withNumber(profHist[i].calls, 64))) {
+            entry->setObject("Calls", num);
+            num->release();
+        }
+        if ((num = OSNumber::withNumber(profHist[i].cycles, 64))) {
+            entry->setObject("Cycles", num);
+            num->release();
+        }
+        if ((hist = OSArray::withCapacity(kProfCycleBuckets))) {
+            for (j = 0; j < kProfCycleBuckets; j++) {
+                if ((num = OSNumber::withNumber(profHist[i].cycleHist[j], 32))) {
+                    hist->setObject(num);
+                    num->release();
+                }
+            }
+            entry->setObject("CycleHistogram", hist);
+            hist->release();
+        }
+        if ((hist = OSArray::withCapacity(kProfWorkBuckets))) {
+            for (j = 0; j < kProfWorkBuckets; j++) {
+                if ((num = OSNumber::withNumber(profHist[i].workHist[j], 32))) {
+                    hist->setObject(num);
+                    num->release();
+                }
+            }
+            entry->setObject((i == kProfTxInterrupt) ? "DescriptorHistogram" : "PacketHistogram", hist);
+            hist->release();
+        }
+        dict->setObject(pathNames[i], entry);
+        entry->release();
     }
-
+    setProperty(kProfStatsName, dict);
+    dict->release();
 }
 
+#endif /* ENABLE_PROFILER */
+
 /* Resets the NIC in case a tx deadlock or a pci error occurred. timerSource and txQueue
  * are stopped immediately but will be restarted by the timer task when the link has
  * been reestablished.
@@ -3307,6 +5053,8 @@ void RTL8100::restartRTL8100()
     if (rxInterrupt(netif, kNumRxDesc, NULL, NULL))
         netif->flushInputQueue();
     
+    /* Return the descriptors of an incomplete group too. */
+    rxReturnDescs(rxNextDescIndex & kRxDescGroupMask);
     rxNextDescIndex = 0;
     deadlockWarn = 0;
     
@@ -3370,10 +5118,17 @@ void RTL8100::startRTL8100(UInt16 newIntrMitigate, bool enableInterrupts)
     
     tp->cp_cmd &= 0x2063;
     
-    WriteReg16(IntrMitigate, intrMitigateValue);
+    if (adaptiveIntrMit) {
+        intrModReset();
+        WriteReg16(IntrMitigate, intrModProfiles[intrMod.profile].intrMitigate);
+    } else {
+        WriteReg16(IntrMitigate, intrMitigateValue);
+    }
     
     WriteReg32(TxDescStartAddrLow, (UInt32)(txPhyAddr & 0x00000000ffffffff));
     WriteReg32(TxDescStartAddrHigh, (UInt32)(txPhyAddr >> 32));
+    WriteReg32(TxHDescStartAddrLow, (UInt32)(txHiPhyAddr & 0x00000000ffffffff));
+    WriteReg32(TxHDescStartAddrHigh, (UInt32)(txHiPhyAddr >> 32));
     WriteReg32(RxDescAddrLow, (UInt32)(rxPhyAddr & 0x00000000ffffffff));
     WriteReg32(RxDescAddrHigh, (UInt32)(rxPhyAddr >> 32));
     
@@ -4273,23 +6028,18 @@ void RTL8100::powerdownPLL()
 #pragma mark --- RTL8100 timer action method ---
 
 /*
- * This is the watchdog timer action routine. Its basic tasks are to:
- *  - check for link status changes and perform post link operations.
- *  - check for transmitter deadlocks.
- *  - update statistics and trigger statistics dumps.
- *
- * As early family members have a broken link change interrupt the
- * watchdog timer routine must check for link changes periodically.
+ * Reads the link state from the PHY status register and performs the
+ * operations required after a link change. Called from the interrupt
+ * handler on LinkChg, or from the watchdog timer for chips which don't
+ * use the link change interrupt.
  */
-
-void RTL8100::timerActionRTL8100(IOTimerEventSource *timer)
+void RTL8100::checkLinkStatus()
 {
     struct rtl8101_private *tp = &linuxData;
     UInt32 data32;
     UInt8 currLinkState;
     bool newLinkState;
     
-    /* Check for link state events. */
     currLinkState = ReadReg8(PHYstatus);
     newLinkState = (currLinkState & LinkStatus) ? true : false;
     
@@ -4368,32 +6118,72 @@ void RTL8100::timerActionRTL8100(IOTimerEventSource *timer)
             }
         }
     }
+}
+
+
+/*
+ * This is the watchdog timer action routine. Its basic tasks are to:
+ *  - check for link status changes and perform post link operations.
+ *  - check for transmitter deadlocks.
+ *  - update statistics and trigger statistics dumps.
+ *
+ * As early family members have a broken link change interrupt the
+ * watchdog timer routine must check for link changes periodically.
+ */
+
+void RTL8100::timerActionRTL8100(IOTimerEventSource *timer)
+{
+    /* Early family members don't signal link changes reliably so that we have to poll. */
+    if (!linkChgIntr)
+        checkLinkStatus();
+    
     /* Check for tx deadlock. */
     if (linkUp) {
         if (checkForDeadlock())
             goto done;
         
         updateStatitics();
-    }
-    /* We can savely free the mbuf here because the timer action gets called
-     * synchronized to the workloop.
+        
+        if (adaptiveIntrMit)
+            intrModSample();
+        
+        if (pollTuning)
+            pollTuneSample();
+    }
+    rxPoolUpdateStats();
+    rxFilterUpdateStats();
+    txReclaimUpdateStats();
+    txQueueUpdateStats();
+    updateAccessStats();
+#if ENABLE_PROFILER
+    updateProfStats();
+#endif
+    
+    if (adaptivePoll)
+        pollTuneUpdateStats();
+    
+    /* We can savely free the packets here because the timer action gets called
+     * synchronized to the workloop. This drains the deferred reclaim queue when
+     * the link has gone idle. All entries are released regardless of their age,
+     * as txReclaimDelay may be 0, i.e. without a time limit.
      */
-    if (txNext2FreeMbuf) {
-        freePacket(txNext2FreeMbuf);
-        txNext2FreeMbuf = NULL;
-    }
+    txReclaimRelease(txReclaimCollect(NULL, 0, true));
     
 done:
+    /* Start a new period for the broadcast limit. */
+    rxFilterBcastCount = 0;
+    
     timerSource->setTimeoutMS(kTimeoutMS);
-    txDescDoneLast = txDescDoneCount;
+    txDescDoneLast[kTxQueueNormal] = txDescDoneCount[kTxQueueNormal];
+    txDescDoneLast[kTxQueueHigh] = txDescDoneCount[kTxQueueHigh];
 }
 
 #pragma mark --- miscellaneous functions ---
 
-static inline UInt32 adjustIPv6Header(mbuf_t m)
+static inline UInt32 adjustIPv6Header(mbuf_t m, RtlHdrInfo *hdrInfo)
 {
-    struct ip6_hdr *ip6Hdr = (struct ip6_hdr *)((UInt8 *)mbuf_data(m) + ETHER_HDR_LEN);
-    struct tcphdr *tcpHdr = (struct tcphdr *)((UInt8 *)ip6Hdr + sizeof(struct ip6_hdr));
+    struct ip6_hdr *ip6Hdr = (struct ip6_hdr *)((UInt8 *)mbuf_data(m) + hdrInfo->l3Offset);
+    struct tcphdr *tcpHdr = (struct tcphdr *)((UInt8 *)mbuf_data(m) + hdrInfo->l4Offset);
     UInt32 plen = ntohs(ip6Hdr->ip6_ctlun.ip6_un1.ip6_un1_plen);
     UInt32 csum = ntohs(tcpHdr->th_sum) - plen;
     
@@ -4401,7 +6191,412 @@ static inline UInt32 adjustIPv6Header(mbuf_t m)
     ip6Hdr->ip6_ctlun.ip6_un1.ip6_un1_plen = 0;
     tcpHdr->th_sum = htons((UInt16)csum);
     
-    return (plen + kMinL4HdrOffsetV6);
+    return (plen + hdrInfo->l4Offset);
+}
+
+/*
+ * Returns a pointer to len bytes of the packet at offset. Headers are usually
+ * found in the first mbuf, otherwise they are copied to buf.
+ */
+static inline const UInt8 *hdrPtr(mbuf_t m, UInt32 offset, UInt32 len, UInt8 *buf)
+{
+    if ((offset + len) <= mbuf_len(m))
+        return ((const UInt8 *)mbuf_data(m) + offset);
+    
+    return (mbuf_copydata(m, offset, len, buf) ? NULL : buf);
+}
+
+static inline bool txInlineVlan(mbuf_t m)
+{
+    UInt16 type;
+    const UInt8 *data = hdrPtr(m, offsetof(struct ether_header, ether_type), sizeof(type), (UInt8 *)&type);
+    
+    return (data && (*(const UInt16 *)data == htons(ETHERTYPE_VLAN)));
+}
+
+/*
+ * Locates the IP and L4 headers of a packet. Handles an inline VLAN tag,
+ * IPv4 options and the IPv6 hop-by-hop, routing and destination options extension
+ * headers. The L4 protocol of IPv4 fragments is reported as 0. Returns false for
+ * anything but IPv4 and IPv6 or a truncated TCP/UDP header.
+ */
+static bool parseHeaders(mbuf_t m, RtlHdrInfo *hdrInfo)
+{
+    UInt8 buf[sizeof(struct ip6_hdr)];
+    const struct ether_header *ethHdr;
+    const struct ip *ipHdr;
+    const struct ip6_hdr *ip6Hdr;
+    const struct ip6_ext *extHdr;
+    const UInt8 *data;
+    UInt32 offset = ETHER_HDR_LEN;
+    UInt16 type;
+    UInt8 proto;
+    
+    if (!(ethHdr = (const struct ether_header *)hdrPtr(m, 0, ETHER_HDR_LEN, buf)))
+        goto fail;
+    
+    type = ethHdr->ether_type;
+    hdrInfo->inlineVlan = false;
+    
+    if (type == htons(ETHERTYPE_VLAN)) {
+        if (!(data = hdrPtr(m, ETHER_HDR_LEN + 2, sizeof(type), buf)))
+            goto fail;
+        
+        type = *(const UInt16 *)data;
+        offset += ETHER_VLAN_ENCAP_LEN;
+        hdrInfo->inlineVlan = true;
+    }
+    hdrInfo->l3Offset = offset;
+    
+    if (type == htons(ETHERTYPE_IP)) {
+        if (!(ipHdr = (const struct ip *)hdrPtr(m, offset, sizeof(struct ip), buf)))
+            goto fail;
+        
+        if (ipHdr->ip_hl < 5)
+            goto fail;
+        
+        proto = (ipHdr->ip_off & htons(IP_MF | IP_OFFMASK)) ? 0 : ipHdr->ip_p;
+        offset += (ipHdr->ip_hl << 2);
+        hdrInfo->isIPv6 = false;
+    } else if (type == htons(ETHERTYPE_IPV6)) {
+        if (!(ip6Hdr = (const struct ip6_hdr *)hdrPtr(m, offset, sizeof(struct ip6_hdr), buf)))
+            goto fail;
+        
+        proto = ip6Hdr->ip6_nxt;
+        offset += sizeof(struct ip6_hdr);
+        
+        while ((proto == IPPROTO_HOPOPTS) || (proto == IPPROTO_ROUTING) || (proto == IPPROTO_DSTOPTS)) {
+            if (!(extHdr = (const struct ip6_ext *)hdrPtr(m, offset, sizeof(struct ip6_ext), buf)))
+                goto fail;
+            
+            proto = extHdr->ip6e_nxt;
+            offset += (extHdr->ip6e_len + 1) << 3;
+        }
+        hdrInfo->isIPv6 = true;
+    } else {
+        goto fail;
+    }
+    if (((proto == IPPROTO_TCP) && ((offset + sizeof(struct tcphdr)) > mbuf_pkthdr_len(m))) ||
+        ((proto == IPPROTO_UDP) && ((offset + sizeof(struct udphdr)) > mbuf_pkthdr_len(m))))
+        goto fail;
+    
+    hdrInfo->l4Offset = offset;
+    hdrInfo->l4Proto = proto;
+    
+    return true;
+    
+fail:
+    return false;
+}
+
+/*
+ * Calculates the requested checksums of a packet in software. Used for frames whose
+ * headers can't be handled by the chip's checksum offload.
+ */
+static bool txSoftwareChecksum(mbuf_t m, RtlHdrInfo *hdrInfo, mbuf_csum_request_flags_t checksums)
+{
+    UInt8 buf[60];
+    const UInt8 *data;
+    UInt32 pktLen = (UInt32)mbuf_pkthdr_len(m);
+    UInt32 l4Len = pktLen - hdrInfo->l4Offset;
+    UInt32 csumOffset;
+    UInt32 sum;
+    UInt16 csum = 0;
+    
+    if (hdrInfo->isIPv6) {
+        if (!(checksums & (kChecksumTCPIPv6 | kChecksumUDPIPv6)))
+            goto done;
+        
+        if (!(data = hdrPtr(m, hdrInfo->l3Offset + offsetof(struct ip6_hdr, ip6_src), 2 * sizeof(struct in6_addr), buf)))
+            goto fail;
+        
+        sum = csumPartial(data, 2 * sizeof(struct in6_addr), htons(hdrInfo->l4Proto));
+    } else {
+        if (checksums & kChecksumIP) {
+            if (!(data = hdrPtr(m, hdrInfo->l3Offset, hdrInfo->l4Offset - hdrInfo->l3Offset, buf)))
+                goto fail;
+            
+            if (data != buf)
+                bcopy(data, buf, hdrInfo->l4Offset - hdrInfo->l3Offset);
+            
+            ((struct ip *)buf)->ip_sum = 0;
+            csum = ipHeaderChecksum((struct ip *)buf);
+            
+            if (mbuf_copyback(m, hdrInfo->l3Offset + offsetof(struct ip, ip_sum), sizeof(csum), &csum, MBUF_DONTWAIT))
+                goto fail;
+        }
+        if (!(checksums & (kChecksumTCP | kChecksumUDP)))
+            goto done;
+        
+        if (!(data = hdrPtr(m, hdrInfo->l3Offset + offsetof(struct ip, ip_src), 2 * sizeof(struct in_addr), buf)))
+            goto fail;
+        
+        sum = csumPartial(data, 2 * sizeof(struct in_addr), htons(hdrInfo->l4Proto));
+    }
+    if ((hdrInfo->l4Proto != IPPROTO_TCP) && (hdrInfo->l4Proto != IPPROTO_UDP))
+        goto fail;
+    
+    /* Clear the checksum field before summing up the TCP/UDP header and payload. */
+    csumOffset = hdrInfo->l4Offset + ((hdrInfo->l4Proto == IPPROTO_TCP) ? offsetof(struct tcphdr, th_sum) : offsetof(struct udphdr, uh_sum));
+    csum = 0;
+    
+    if (mbuf_copyback(m, csumOffset, sizeof(csum), &csum, MBUF_DONTWAIT))
+        goto fail;
+    
+    sum += htons((UInt16)(l4Len >> 16)) + htons((UInt16)l4Len);
+    csum = ~csumFold(csumMbuf(m, hdrInfo->l4Offset, l4Len, sum));
+    
+    if ((hdrInfo->l4Proto == IPPROTO_UDP) && !csum)
+        csum = 0xffff;
+    
+    if (mbuf_copyback(m, csumOffset, sizeof(csum), &csum, MBUF_DONTWAIT))
+        goto fail;
+    
+done:
+    return true;
+    
+fail:
+    return false;
+}
+
+/*
+ * Verifies the checksums of a received TCP/UDP/IP packet in software and returns
+ * the mask of the checksums found to be valid.
+ */
+static UInt32 rxSoftwareChecksum(mbuf_t m)
+{
+    RtlHdrInfo hdrInfo;
+    UInt8 buf[60];
+    const UInt8 *data;
+    const struct ip *ipHdr;
+    const struct ip6_hdr *ip6Hdr;
+    UInt32 pktLen = (UInt32)mbuf_pkthdr_len(m);
+    UInt32 l3Len, l4Len;
+    UInt32 result = 0;
+    UInt32 sum;
+    
+    if (!parseHeaders(m, &hdrInfo))
+        goto done;
+    
+    l3Len = hdrInfo.l4Offset - hdrInfo.l3Offset;
+    
+    if (hdrInfo.isIPv6) {
+        if (!(ip6Hdr = (const struct ip6_hdr *)hdrPtr(m, hdrInfo.l3Offset, sizeof(struct ip6_hdr), buf)))
+            goto done;
+        
+        /* Use the length from the header as short frames are padded. The payload
+         * must at least cover the extension headers.
+         */
+        if ((ntohs(ip6Hdr->ip6_plen) + sizeof(struct ip6_hdr)) < l3Len)
+            goto done;
+        
+        l4Len = ntohs(ip6Hdr->ip6_plen) + sizeof(struct ip6_hdr) - l3Len;
+        sum = csumPartial((const UInt8 *)&ip6Hdr->ip6_src, 2 * sizeof(struct in6_addr), 0);
+    } else {
+        if (!(data = hdrPtr(m, hdrInfo.l3Offset, l3Len, buf)))
+            goto done;
+        
+        if (csumFold(csumPartial(data, l3Len, 0)) != 0xffff)
+            goto done;
+        
+        ipHdr = (const struct ip *)data;
+        
+        if (ntohs(ipHdr->ip_len) < l3Len)
+            goto done;
+        
+        result = kChecksumIP;
+        l4Len = ntohs(ipHdr->ip_len) - l3Len;
+        sum = csumPartial((const UInt8 *)&ipHdr->ip_src, 2 * sizeof(struct in_addr), 0);
+    }
+    if (((hdrInfo.l4Proto != IPPROTO_TCP) && (hdrInfo.l4Proto != IPPROTO_UDP)) ||
+        ((hdrInfo.l4Offset + l4Len) > pktLen))
+        goto done;
+    
+    sum += htons(hdrInfo.l4Proto) + htons((UInt16)(l4Len >> 16)) + htons((UInt16)l4Len);
+    
+    if (csumFold(csumMbuf(m, hdrInfo.l4Offset, l4Len, sum)) != 0xffff)
+        goto done;
+    
+    if (hdrInfo.isIPv6)
+        result = (hdrInfo.l4Proto == IPPROTO_TCP) ? kChecksumTCPIPv6 : kChecksumUDPIPv6;
+    else
+        result |= (hdrInfo.l4Proto == IPPROTO_TCP) ? kChecksumTCP : kChecksumUDP;
+    
+done:
+    return result;
+}
+
+static inline UInt16 ipHeaderChecksum(struct ip *ipHdr)
+{
+    UInt16 *data = (UInt16 *)ipHdr;
+    UInt32 len = ipHdr->ip_hl << 1;
+    UInt32 sum = 0;
+    
+    while (len--)
+        sum += *data++;
+    
+    sum = (sum >> 16) + (sum & 0xffff);
+    sum += (sum >> 16);
+    
+    return (UInt16)~sum;
+}
+
+/* Number of free descriptors in a tx ring of numDesc descriptors. The ring is never
+ * filled completely, so that equal indices always mean an empty ring.
+ */
+static inline UInt32 txFreeDesc(UInt32 nextIndex, UInt32 dirtyIndex, UInt32 numDesc)
+{
+    return numDesc - ((nextIndex - dirtyIndex) & (numDesc - 1));
+}
+
+/* Interactive voice and network control traffic, which includes pure TCP ACKs,
+ * qualifies for the high priority queue. Interactive video is left out as its
+ * bandwidth would crowd out the small packets the queue is meant for.
+ */
+static inline bool txHighPriority(mbuf_t m)
+{
+    mbuf_svc_class_t sc = mbuf_get_service_class(m);
+    
+    return ((sc == MBUF_SC_VO) || (sc == MBUF_SC_CTL));
+}
+
+/* The 48 bit address as table key. As multicast addresses have the group bit
+ * set, a key is never 0, which marks an empty slot.
+ */
+static inline UInt64 mcTableKey(const UInt8 *addr)
+{
+    return ((UInt64)*(const UInt32 *)addr | ((UInt64)*(const UInt16 *)(addr + 4) << 32));
+}
+
+/* Fibonacci hashing, taking the slot from the product's upper bits. */
+static inline UInt32 mcTableHash(UInt64 key)
+{
+    return (UInt32)((key * 0x9e3779b97f4a7c15ULL) >> (64 - kMCTableShift));
+}
+
+static void mcTableInsert(UInt64 *table, const UInt8 *addr)
+{
+    UInt64 key = mcTableKey(addr);
+    UInt32 slot = mcTableHash(key);
+    
+    /* Address lists may contain duplicates. */
+    while (table[slot] && (table[slot] != key))
+        slot = (slot + 1) & kMCTableMask;
+    
+    table[slot] = key;
+}
+
+static inline bool mcTableLookup(const UInt64 *table, const UInt8 *addr)
+{
+    UInt64 key = mcTableKey(addr);
+    UInt32 slot = mcTableHash(key);
+    
+    while (table[slot]) {
+        if (table[slot] == key)
+            return true;
+        
+        slot = (slot + 1) & kMCTableMask;
+    }
+    return false;
+}
+
+static inline void txQueueSample(RtlTxQueueStats *stats, UInt32 used)
+{
+    stats->occupancy += used;
+    stats->samples++;
+    
+    if (used > stats->occupancyMax)
+        stats->occupancyMax = used;
+}
+
+/*
+ * Adds the 16 bit words of a buffer to a ones' complement sum. The sum isn't folded,
+ * so it can be continued. Only the last call of a sequence may use an odd length.
+ */
+static UInt32 csumPartial(const UInt8 *data, UInt32 len, UInt32 sum)
+{
+    const UInt32 *words = (const UInt32 *)data;
+    UInt64 acc0 = sum;
+    UInt64 acc1 = 0;
+    
+    /* The sum of 32 bit words folds to the same ones' complement sum as the sum of
+     * 16 bit words, so we can process 32 bytes per iteration using two independent
+     * 64 bit accumulators, which can't overflow for any realistic length.
+     */
+    while (len >= 32) {
+        acc0 += words[0];
+        acc1 += words[1];
+        acc0 += words[2];
+        acc1 += words[3];
+        acc0 += words[4];
+        acc1 += words[5];
+        acc0 += words[6];
+        acc1 += words[7];
+        words += 8;
+        len -= 32;
+    }
+    while (len >= 4) {
+        acc0 += *words++;
+        len -= 4;
+    }
+    data = (const UInt8 *)words;
+    
+    if (len >= 2) {
+        acc1 += *(const UInt16 *)data;
+        data += 2;
+        len -= 2;
+    }
+    if (len)
+        acc1 += OSSwapHostToBigInt16((UInt16)(*data << 8));
+    
+    acc0 += acc1;
+    acc0 = (acc0 >> 32) + (acc0 & 0xffffffff);
+    acc0 += (acc0 >> 32);
+    
+    return (UInt32)acc0;
+}
+
+static inline UInt16 csumFold(UInt32 sum)
+{
+    sum = (sum >> 16) + (sum & 0xffff);
+    sum += (sum >> 16);
+    
+    return (UInt16)sum;
+}
+
+/*
+ * Adds len bytes of an mbuf chain starting at offset to a ones' complement sum.
+ * Pieces starting at an odd position are byte swapped to keep the words aligned.
+ */
+static UInt32 csumMbuf(mbuf_t m, UInt32 offset, UInt32 len, UInt32 sum)
+{
+    UInt64 acc = sum;
+    UInt32 piece, pieceSum;
+    bool odd = false;
+    
+    for (; m && len; m = mbuf_next(m)) {
+        if (offset >= mbuf_len(m)) {
+            offset -= mbuf_len(m);
+            continue;
+        }
+        piece = (UInt32)mbuf_len(m) - offset;
+        
+        if (piece > len)
+            piece = len;
+        
+        pieceSum = csumFold(csumPartial((UInt8 *)mbuf_data(m) + offset, piece, 0));
+        acc += (odd) ? OSSwapInt16((UInt16)pieceSum) : pieceSum;
+        
+        if (piece & 1)
+            odd = !odd;
+        
+        len -= piece;
+        offset = 0;
+    }
+    acc = (acc >> 32) + (acc & 0xffffffff);
+    acc += (acc >> 32);
+    
+    return (UInt32)acc;
 }
 
 static unsigned const ethernet_polynomial = 0x04c11db7U;
@@ -4421,3 +6616,186 @@ static inline u32 ether_crc(int length, unsigned char *data)
     return crc;
 }
 
+/*
+ * The adaptive interrupt moderation engine's decision logic. It doesn't touch
+ * the hardware so that it can be fed with recorded rate traces.
+ *
+ * The load is the larger of packet rate and byte rate observed during the
+ * last sample period, relative to what the link is able to carry, in per
+ * mille. As the link is full-duplex, it is taken per direction and the busier
+ * direction counts. The profile is changed by one step at a time and only after
+ * kIntrModStableSamples consecutive samples asked for the same change, with
+ * the exception of an idle link which returns to the lowest latency profile
+ * at once.
+ */
+static UInt32 intrModSelectProfile(RtlIntrModState *state, UInt64 rxPackets, UInt64 rxBytes, UInt64 txPackets, UInt64 txBytes, UInt64 elapsed, UInt32 linkSpeed)
+{
+    const RtlIntrModProfile *profile = &intrModProfiles[state->profile];
+    UInt64 maxBytes, maxPackets;
+    UInt64 rxLoad, txLoad, load;
+    UInt32 next = state->profile;
+    
+    if (!(rxPackets + txPackets) || !elapsed) {
+        state->profile = 0;
+        state->candidate = 0;
+        state->candidateCount = 0;
+        goto done;
+    }
+    /* Line rate in bytes and in minimum sized frames (including preamble and IFG). */
+    maxBytes = (((UInt64)linkSpeed * (MBit / 8)) * elapsed) / 1000000000ULL;
+    maxPackets = maxBytes / 84;
+    
+    if (!maxPackets)
+        maxPackets = 1;
+    
+    rxLoad = intrModLoad(rxPackets, rxBytes, maxPackets);
+    txLoad = intrModLoad(txPackets, txBytes, maxPackets);
+    load = (rxLoad > txLoad) ? rxLoad : txLoad;
+    
+    if ((load >= profile->upLoad) && (state->profile < (kIntrModNumProfiles - 1)))
+        next = state->profile + 1;
+    else if ((load < profile->downLoad) && (state->profile > 0))
+        next = state->profile - 1;
+    
+    if (next != state->candidate) {
+        state->candidate = next;
+        state->candidateCount = 0;
+    }
+    if ((next != state->profile) && (++state->candidateCount >= kIntrModStableSamples)) {
+        state->profile = next;
+        state->candidateCount = 0;
+    }
+    
+done:
+    return state->profile;
+}
+
+/* Load of one direction in per mille: the larger of packet rate and byte rate. */
+static inline UInt64 intrModLoad(UInt64 packets, UInt64 bytes, UInt64 maxPackets)
+{
+    UInt64 pktLoad = (packets * 1000) / maxPackets;
+    UInt64 byteLoad = (bytes * 1000) / (maxPackets * 84);
+    
+    return (pktLoad > byteLoad) ? pktLoad : byteLoad;
+}
+
+/*
+ * The packet polling parameter tuning's decision logic. Like the interrupt
+ * moderation engine's, it doesn't touch the hardware or the interface so that
+ * it can be replayed with recorded traces.
+ *
+ * The pressure is the larger of the rx load, relative to what the link is able
+ * to carry, and the occupancy of the rx ring, estimated from the largest receive
+ * pass of the sample, both in per mille. Bursty traffic, whose largest pass
+ * exceeds the mean by kPollTuneBurstRatio percent, moves up at half the
+ * pressure, as its bursts fill the ring faster than the average rate suggests.
+ * Like with interrupt moderation, profiles change by one step after
+ * kPollTuneStableSamples consecutive samples and an idle link returns to the
+ * first profile at once.
+ */
+static UInt32 pollTuneSelectProfile(RtlPollTuneState *state, UInt64 packets, UInt64 bytes, UInt64 passes, UInt32 maxBatch, UInt64 elapsed, UInt32 linkSpeed)
+{
+    const RtlPollTuneProfile *profile = &pollTuneProfiles[state->profile];
+    UInt64 maxBytes, maxPackets;
+    UInt64 pktLoad, byteLoad;
+    UInt32 pressure, upLoad;
+    UInt32 reason;
+    UInt32 next = state->profile;
+    
+    if (!packets || !passes || !elapsed) {
+        state->load = 0;
+        state->occupancy = 0;
+        state->burstiness = 0;
+        state->profile = 0;
+        state->candidate = 0;
+        state->candidateCount = 0;
+        state->reason = kPollTuneReasonIdle;
+        goto done;
+    }
+    /* Line rate in bytes and in minimum sized frames (including preamble and IFG). */
+    maxBytes = (((UInt64)linkSpeed * (MBit / 8)) * elapsed) / 1000000000ULL;
+    maxPackets = maxBytes / 84;
+    
+    if (!maxPackets)
+        maxPackets = 1;
+    
+    pktLoad = (packets * 1000) / maxPackets;
+    byteLoad = (bytes * 1000) / (maxPackets * 84);
+    state->load = (UInt32)((pktLoad > byteLoad) ? pktLoad : byteLoad);
+    state->occupancy = (maxBatch * 1000) / kNumRxDesc;
+    state->burstiness = (UInt32)((maxBatch * passes * 100) / packets);
+    
+    if (state->occupancy > state->load) {
+        pressure = state->occupancy;
+        reason = kPollTuneReasonOccupancy;
+    } else {
+        pressure = state->load;
+        reason = kPollTuneReasonLoad;
+    }
+    upLoad = profile->upLoad;
+    
+    if (state->burstiness >= kPollTuneBurstRatio) {
+        upLoad /= 2;
+        
+        if (pressure < profile->upLoad)
+            reason = kPollTuneReasonBurst;
+    }
+    if ((pressure >= upLoad) && (state->profile < (kPollTuneNumProfiles - 1)))
+        next = state->profile + 1;
+    else if ((pressure < profile->downLoad) && (state->profile > 0))
+        next = state->profile - 1;
+    
+    if (next != state->candidate) {
+        state->candidate = next;
+        state->candidateCount = 0;
+    }
+    if ((next != state->profile) && (++state->candidateCount >= kPollTuneStableSamples)) {
+        state->profile = next;
+        state->candidateCount = 0;
+        state->reason = reason;
+    }
+    
+done:
+    return state->profile;
+}
+
+static inline void pollTuneGetParams(const RtlPollTuneProfile *profile, IONetworkPacketPollingParameters *params)
+{
+    bzero(params, sizeof(IONetworkPacketPollingParameters));
+    params->lowThresholdPackets = profile->lowThresholdPackets;
+    params->highThresholdPackets = profile->highThresholdPackets;
+    params->lowThresholdBytes = profile->lowThresholdBytes;
+    params->highThresholdBytes = profile->highThresholdBytes;
+    params->pollIntervalTime = profile->pollInterval * 1000ULL;
+}
+
+#if ENABLE_PROFILER
+
+static inline UInt64 profReadCycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return mach_absolute_time();
+#endif
+}
+
+/* Returns 0 for 0 and n for values from 2^(n-1) to 2^n - 1, clamped to the last bucket. */
+static inline UInt32 profBucket(UInt64 value, UInt32 numBuckets)
+{
+    UInt32 bucket = value ? (64 - __builtin_clzll(value)) : 0;
+    
+    return (bucket < numBuckets) ? bucket : (numBuckets - 1);
+}
+
+static inline void profRecord(RtlProfHist *hist, UInt64 start, UInt32 work)
+{
+    UInt64 cycles = profReadCycles() - start;
+    
+    hist->calls++;
+    hist->cycles += cycles;
+    hist->cycleHist[profBucket(cycles, kProfCycleBuckets)]++;
+    hist->workHist[profBucket(work, kProfWorkBuckets)]++;
+}
+
+#endif /* ENABLE_PROFILER */
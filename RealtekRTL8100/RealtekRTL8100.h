@@ -26,6 +26,19 @@
 #define DebugLog(args...)
 #endif
 
+/* Set to 1 to compile in the hot path profiler. */
+#ifndef ENABLE_PROFILER
+#define ENABLE_PROFILER 0
+#endif
+
+#if ENABLE_PROFILER
+#define ProfStart(start)            UInt64 start = profReadCycles()
+#define ProfEnd(path, start, work)  profRecord(&profHist[(path)], (start), (work))
+#else
+#define ProfStart(start)
+#define ProfEnd(path, start, work)
+#endif
+
 #define	RELEASE(x)	if(x){(x)->release();(x)=NULL;}
 
 #define WriteReg8(reg, val8)    _OSWriteInt8((baseAddr), (reg), (val8))
@@ -111,11 +124,48 @@ typedef struct RtlStatData {
 #define kTxDescSize    (kNumTxDesc*sizeof(struct RtlDmaDesc))
 #define kRxDescSize    (kNumRxDesc*sizeof(struct RtlDmaDesc))
 
+/* High priority tx ring, bound to the HPQ poll bit (must be a power of 2 too). */
+#define kNumTxHiDesc    128
+#define kTxHiLastDesc   (kNumTxHiDesc - 1)
+#define kTxHiDescMask   (kNumTxHiDesc - 1)
+#define kTxHiDescSize   (kNumTxHiDesc*sizeof(struct RtlDmaDesc))
+
+/* Size of a cache line, used to keep the tx ring indices apart. */
+#define kCacheLineSize 64
+
+/* Rx descriptors are returned to the chip in groups filling a cache line. */
+#define kRxDescGroupSize    (kCacheLineSize / sizeof(struct RtlDmaDesc))
+#define kRxDescGroupMask    (kRxDescGroupSize - 1)
+
 /* This is the receive buffer size (must be large enough to hold a packet). */
 #define kRxBufferPktSize    2000
-#define kRxNumSpareMbufs    100
+
+/* Size of the driver owned receive buffer pool and its refill watermarks. */
+#define kRxPoolSize         256
+#define kRxPoolLowWater     64
+#define kRxPoolHighWater    192
+
+/* Above this number of multicast addresses the hash filter accepts all multicasts. */
 #define kMCFilterLimit  32
 
+/* Exact multicast table of the early rx filter: open addressing with linear probing.
+ * The size must be a power of 2 and the limit keeps the load factor at 1/2.
+ */
+#define kMCTableSize    1024
+#define kMCTableMask    (kMCTableSize - 1)
+#define kMCTableShift   10      /* log2(kMCTableSize) */
+#define kMCTableLimit   512
+
+/* Early rx filter: maximum number of rules and number of VLAN IDs. */
+#define kRxFilterMaxRules   8
+#define kRxFilterNumVlans   4096
+
+/* Default number of packets received per pass of the interrupt handler. */
+#define kRxBudgetDefault    64
+
+/* Interrupts which are masked while a receive pass is pending. */
+#define kRxIntrMask         (RxOK | RxErr | RxDescUnavail)
+
 /* statitics timer period in ms. */
 #define kTimeoutMS 1000
 
@@ -129,12 +179,232 @@ typedef struct RtlStatData {
 #define kTxDeadlockTreshhold 3
 #define kTxCheckTreshhold (kTxDeadlockTreshhold - 1)
 
+/* Tx bounce buffers: one slot per descriptor of both tx rings and the default copy threshold. */
+#define kTxBounceSlotSize       256
+#define kTxBounceSize           ((kNumTxDesc + kNumTxHiDesc) * kTxBounceSlotSize)
+#define kTxCopyThresholdDefault 256
+
+/* Deferred tx reclaim: queue size per tx ring (must be a power of 2) and default release conditions. */
+#define kTxReclaimQueueSize     64
+#define kTxReclaimQueueMask     (kTxReclaimQueueSize - 1)
+#define kTxReclaimDescsDefault  1
+#define kTxReclaimDelayDefault  20      /* µs */
+
+/* Receive coalescing: number of tracked flows and limits of a coalesced packet. */
+#define kRxCoalNumFlows     8
+#define kRxCoalMaxSegs      16
+#define kRxCoalMaxIPLength  0xfc00
+
+/* Adaptive interrupt moderation sample period in ms. */
+#define kIntrModSampleMS 100
+
+/* Number of consecutive samples required before changing the profile. */
+#define kIntrModStableSamples 2
+
+/* Number of interrupt moderation profiles. */
+#define kIntrModNumProfiles 5
+
+/* Packet polling parameter tuning: sample period in ms, consecutive samples required
+ * before changing the profile, number of profiles and the peak to mean ratio of the
+ * receive passes (in percent) above which traffic is considered bursty.
+ */
+#define kPollTuneSampleMS       100
+#define kPollTuneStableSamples  3
+#define kPollTuneNumProfiles    4
+#define kPollTuneBurstRatio     400
+
+/* Hot path profiler: number of log2 buckets for cycles and work per call. */
+#define kProfCycleBuckets   24
+#define kProfWorkBuckets    12
+
 /* IPv4 specific stuff */
 #define kMinL4HdrOffsetV4 34
 
 /* IPv6 specific stuff */
 #define kMinL4HdrOffsetV6 54
 
+/* Largest header template supported by software segmentation. */
+#define kMaxTsoHdrLen 256
+
+/* Header layout of a packet, as found by parseHeaders() */
+typedef struct RtlHdrInfo {
+    UInt16 l3Offset;        /* offset of the IP header */
+    UInt16 l4Offset;        /* offset of the TCP/UDP header */
+    UInt8 l4Proto;          /* IPPROTO_TCP or IPPROTO_UDP */
+    bool isIPv6;
+    bool inlineVlan;        /* the frame carries an 802.1Q tag in its data */
+} RtlHdrInfo;
+
+/* Interrupt moderation profile */
+typedef struct RtlIntrModProfile {
+    UInt16 intrMitigate;    /* value for the IntrMitigate register */
+    UInt16 upLoad;          /* switch to the next profile at or above this load (per mille) */
+    UInt16 downLoad;        /* switch to the previous profile below this load (per mille) */
+} RtlIntrModProfile;
+
+/* State of the adaptive interrupt moderation engine */
+typedef struct RtlIntrModState {
+    UInt64 rxPackets;       /* running totals, updated by the rx path */
+    UInt64 rxBytes;
+    UInt64 txPackets;       /* running totals, updated by outputStart() */
+    UInt64 txBytes;
+    UInt64 lastRxPackets;   /* totals at the last sample */
+    UInt64 lastRxBytes;
+    UInt64 lastTxPackets;
+    UInt64 lastTxBytes;
+    UInt64 lastSample;      /* uptime of the last sample in ns */
+    UInt32 profile;         /* current profile index */
+    UInt32 candidate;       /* profile suggested by the last samples */
+    UInt32 candidateCount;  /* number of consecutive samples suggesting candidate */
+} RtlIntrModState;
+
+/* Packet polling parameter profile */
+typedef struct RtlPollTuneProfile {
+    UInt32 lowThresholdPackets;
+    UInt32 highThresholdPackets;
+    UInt32 lowThresholdBytes;
+    UInt32 highThresholdBytes;
+    UInt32 pollInterval;    /* µs */
+    UInt16 upLoad;          /* switch to the next profile at or above this pressure (per mille) */
+    UInt16 downLoad;        /* switch to the previous profile below this pressure (per mille) */
+} RtlPollTuneProfile;
+
+/* Reason for a profile change of the packet polling parameter tuning */
+enum
+{
+    kPollTuneReasonIdle = 0,
+    kPollTuneReasonLoad,
+    kPollTuneReasonOccupancy,
+    kPollTuneReasonBurst,
+    kPollTuneReasonCount
+};
+
+/* State of the packet polling parameter tuning */
+typedef struct RtlPollTuneState {
+    UInt64 rxPasses;        /* receive passes which returned packets, updated by rxInterrupt() */
+    UInt32 rxMaxBatch;      /* largest receive pass of the current sample */
+    UInt64 lastPackets;     /* totals at the last sample */
+    UInt64 lastBytes;
+    UInt64 lastPasses;
+    UInt64 lastSample;      /* uptime of the last sample in ns */
+    UInt32 load;            /* rx load of the last sample (per mille of the link's capacity) */
+    UInt32 occupancy;       /* largest receive pass of the last sample (per mille of the ring) */
+    UInt32 burstiness;      /* peak to mean ratio of the receive passes of the last sample (percent) */
+    UInt32 profile;         /* current profile index */
+    UInt32 candidate;       /* profile suggested by the last samples */
+    UInt32 candidateCount;  /* number of consecutive samples suggesting candidate */
+    UInt32 reason;          /* reason for the last profile change */
+    UInt32 changes;         /* number of parameter updates */
+} RtlPollTuneState;
+
+/* A mapped receive buffer waiting in the pool */
+typedef struct RtlRxBuffer {
+    mbuf_t mbuf;
+    IOPhysicalAddress64 phyAddr;
+    UInt32 length;
+} RtlRxBuffer;
+
+/* Operations of the early rx filter */
+enum
+{
+    kRxFilterOpBroadcastLimit = 0,  /* drop broadcasts beyond arg per watchdog period */
+    kRxFilterOpMulticastExact,      /* drop multicasts which aren't in the multicast list */
+    kRxFilterOpVlanAllow,           /* drop tagged frames whose VLAN ID isn't in rxFilterVlans */
+    kRxFilterOpEtherTypeDrop,       /* drop frames with EtherType arg (network byte order) */
+    kRxFilterOpCount
+};
+
+/* A rule of the early rx filter */
+typedef struct RtlRxFilterRule {
+    UInt32 op;
+    UInt32 arg;
+    UInt64 hits;            /* frames dropped by this rule */
+} RtlRxFilterRule;
+
+/* Update of an rx descriptor held back until its group is returned to the chip */
+typedef struct RtlRxRefill {
+    UInt64 addr;            /* new buffer address or 0 if the buffer is unchanged */
+    UInt32 opts1;
+} RtlRxRefill;
+
+/* Receive buffer pool statistics */
+typedef struct RtlRxPoolStats {
+    UInt64 hits;            /* received packets which got their replacement from the pool */
+    UInt64 misses;          /* received packets which had to fall back to replaceOrCopyPacket() */
+    UInt64 refills;         /* number of bulk refills */
+    UInt64 refillTime;      /* accumulated refill time in ns */
+    UInt64 refillTimeMax;   /* longest refill in ns */
+} RtlRxPoolStats;
+
+/* A transmitted packet waiting in the deferred reclaim queue */
+typedef struct RtlTxReclaimEntry {
+    mbuf_t mbuf;
+    UInt64 doneCount;       /* txDescDoneCount of its ring when its last descriptor was returned */
+    UInt64 doneTime;        /* uptime in ns when its last descriptor was returned */
+} RtlTxReclaimEntry;
+
+/* Statistics of the batched mbuf release on tx completion */
+typedef struct RtlTxReclaimStats {
+    UInt64 batches;         /* number of batched frees */
+    UInt64 packets;         /* packets released by these batches */
+    UInt32 maxBatch;        /* largest batch */
+} RtlTxReclaimStats;
+
+/* Tx queues, each with its own descriptor ring */
+enum
+{
+    kTxQueueNormal = 0,
+    kTxQueueHigh,
+    kTxQueueCount
+};
+
+/* Occupancy and latency statistics of a tx queue. The occupancy is sampled by
+ * outputStart() and the latency is measured by txInterrupt().
+ */
+typedef struct RtlTxQueueStats {
+    UInt64 packets;         /* completed packets */
+    UInt64 latency;         /* accumulated time from posting to completion in ns */
+    UInt64 latencyMax;      /* longest time from posting to completion in ns */
+    UInt64 occupancy;       /* accumulated number of descriptors in use */
+    UInt64 samples;         /* number of occupancy samples */
+    UInt32 occupancyMax;    /* largest number of descriptors in use */
+} RtlTxQueueStats;
+
+/* A TCP/IPv4 flow being coalesced by the receiver */
+typedef struct RtlRxCoalFlow {
+    mbuf_t head;            /* first segment, carries the headers */
+    mbuf_t tail;            /* last mbuf of the chain */
+    UInt32 srcAddr;         /* addresses and ports in network byte order */
+    UInt32 dstAddr;
+    UInt16 srcPort;
+    UInt16 dstPort;
+    UInt32 nextSeq;         /* next expected sequence number */
+    UInt32 ipLength;        /* IP length of the coalesced packet */
+    UInt16 tcpHdrLength;
+    UInt16 vlanTag;
+    UInt16 numSegs;
+} RtlRxCoalFlow;
+
+/* Hot paths covered by the profiler */
+enum
+{
+    kProfInterrupt = 0,
+    kProfRxInterrupt,
+    kProfTxInterrupt,
+    kProfOutputStart,
+    kProfCount
+};
+
+/* Profile of a hot path. Each hot path has a single writer at a time, so that the
+ * counters can be updated without locking.
+ */
+typedef struct RtlProfHist {
+    UInt64 calls;
+    UInt64 cycles;                          /* accumulated cycles */
+    UInt32 cycleHist[kProfCycleBuckets];    /* bucket n: calls which took 2^(n-1) to 2^n - 1 cycles */
+    UInt32 workHist[kProfWorkBuckets];      /* same for packets (descriptors with txInterrupt()) per call */
+} RtlProfHist;
+
 /* This definitions should have been in IOPCIDevice.h. */
 enum
 {
@@ -168,8 +438,30 @@ enum
 #define kEnableTSO4Name "enableTSO4"
 #define kEnableTSO6Name "enableTSO6"
 #define kIntrMitigateName "intrMitigate"
+#define kAdaptiveIntrMitName "adaptiveIntrMitigate"
+#define kAdaptivePollName "adaptivePolling"
+#define kRxCopybreakName "rxCopybreak"
+#define kRxCoalescingName "rxCoalescing"
+#define kRxBudgetName "rxBudget"
+#define kRxFilterName "rxFilter"
+#define kRxFilterBcastLimitName "BroadcastLimit"
+#define kRxFilterMcExactName "ExactMulticast"
+#define kRxFilterVlansName "AllowedVlans"
+#define kRxFilterEtherTypesName "DropEtherTypes"
+#define kTxCopyThresholdName "txCopyThreshold"
+#define kTxReclaimDescsName "txReclaimDescs"
+#define kTxReclaimDelayName "txReclaimDelay"
+#define kTxHiQueueName "txHighPriorityQueue"
 #define kDisableASPMName "disableASPM"
 #define kDriverVersionName "Driver_Version"
+#define kRxPoolStatsName "RxBufferPool"
+#define kRxFilterStatsName "RxFilter"
+#define kPhyMcuStatsName "PhyMicrocode"
+#define kTxReclaimStatsName "TxReclaim"
+#define kTxQueueStatsName "TxQueues"
+#define kAccessStatsName "RegisterAccessLatency"
+#define kProfStatsName "HotPathProfile"
+#define kPollTuneStatsName "PollTuning"
 #define kNameLenght 64
 
 #define kEnableRxPollName "rxPolling"
@@ -239,15 +531,37 @@ private:
     void pciErrorInterrupt();
     void txInterrupt();
     void interruptOccurredPoll(OSObject *client, IOInterruptEventSource *src, int count);
+    void rxBudgetOccurred(OSObject *client, IOInterruptEventSource *src, int count);
     UInt32 rxInterrupt(IONetworkInterface *interface, uint32_t maxCount, IOMbufQueue *pollQueue, void *context);
     bool setupDMADescriptors();
     void freeDMADescriptors();
     void txClearDescriptors();
+    void rxPoolRefill(UInt32 target);
+    void rxPoolFree();
+    void rxPoolUpdateStats();
+    inline void rxReturnDescs(UInt32 count);
+    mbuf_t txReclaimCollect(mbuf_t freeList, UInt64 now, bool all);
+    void txReclaimRelease(mbuf_t freeList);
+    void txReclaimUpdateStats();
+    UInt32 txCompleteDescs(RtlDmaDesc *descArray, mbuf_t *mbufArray, UInt64 *postTime, UInt32 descMask, UInt32 nextIndex, UInt32 dirtyIndex, UInt64 now, mbuf_t *freeList, UInt32 ring);
+    void txQueueUpdateStats();
+    void updatePhyMcuStats();
+    void updateAccessStats();
+#if ENABLE_PROFILER
+    void updateProfStats();
+#endif
+    bool rxCoalesce(IONetworkInterface *interface, mbuf_t m, UInt16 vlanTag, IOMbufQueue *pollQueue);
+    void rxCoalFlush(IONetworkInterface *interface, RtlRxCoalFlow *flow, IOMbufQueue *pollQueue);
+    void rxCoalFlushAll(IONetworkInterface *interface, IOMbufQueue *pollQueue);
+    void rxFilterCompile(OSDictionary *config);
+    inline bool rxFilterDrop(const UInt8 *frame, UInt32 length, UInt16 vlanTag);
+    void rxFilterUpdateStats();
 
     void updateStatitics();
     void setLinkUp(UInt8 linkState);
     void setLinkDown();
     bool checkForDeadlock();
+    void checkLinkStatus();
     
     /* Hardware initialization methods. */
     bool initRTL8100();
@@ -269,14 +583,29 @@ private:
 
     void powerdownPLL();
 
-    /* Hardware specific methods */
-    inline void getChecksumCommand(UInt32 *cmd1, UInt32 *cmd2, mbuf_csum_request_flags_t checksums);
-    inline void getTso4Command(UInt32 *cmd1, UInt32 *cmd2, UInt32 mssValue, mbuf_tso_request_flags_t tsoFlags);
-    inline void getTso6Command(UInt32 *cmd1, UInt32 *cmd2, UInt32 mssValue, mbuf_tso_request_flags_t tsoFlags);
-    inline void getChecksumResult(mbuf_t m, UInt32 status1, UInt32 status2);
+    /* Hardware specific methods, specialized for the descriptor format (rev2 = revision2) */
+    template <bool rev2> inline void getChecksumCommand(UInt32 *cmd1, UInt32 *cmd2, mbuf_csum_request_flags_t checksums, UInt32 l4Offset);
+    template <bool rev2> inline void getTso4Command(UInt32 *cmd1, UInt32 *cmd2, UInt32 mssValue, UInt32 l4Offset);
+    inline void getTso6Command(UInt32 *cmd1, UInt32 *cmd2, UInt32 mssValue, UInt32 l4Offset);
+    mbuf_t txSegmentTso(mbuf_t m, UInt32 mssValue, RtlHdrInfo *hdrInfo);
+    template <bool rev2> inline void getChecksumResult(mbuf_t m, UInt32 status1, UInt32 status2);
+    
+    /* Hot paths, specialized for the descriptor format and selected by selectHotPaths() */
+    template <bool rev2> IOReturn outputStartPackets(IONetworkInterface *interface, IOOptionBits options);
+    template <bool rev2> UInt32 rxPackets(IONetworkInterface *interface, uint32_t maxCount, IOMbufQueue *pollQueue, void *context);
+    void selectHotPaths();
     
     void timerActionRTL8100(IOTimerEventSource *timer);
     
+    /* Adaptive interrupt moderation */
+    void intrModReset();
+    void intrModSample();
+    
+    /* Adaptive packet polling parameters */
+    void pollTuneReset();
+    void pollTuneSample();
+    void pollTuneUpdateStats();
+    
 private:
 	IOWorkLoop *workLoop;
     IOCommandGate *commandGate;
@@ -286,22 +615,43 @@ private:
 	IOBasicOutputQueue *txQueue;
 	
 	IOInterruptEventSource *interruptSource;
+    IOInterruptEventSource *rxBudgetSource;
 	IOTimerEventSource *timerSource;
 	IOEthernetInterface *netif;
 	IOMemoryMap *baseMap;
     volatile void *baseAddr;
     
     /* transmitter data */
-    mbuf_t txNext2FreeMbuf;
     IOBufferMemoryDescriptor *txBufDesc;
     IOPhysicalAddress64 txPhyAddr;
+    IOPhysicalAddress64 txHiPhyAddr;
     struct RtlDmaDesc *txDescArray;
+    struct RtlDmaDesc *txHiDescArray;
     IOMbufNaturalMemoryCursor *txMbufCursor;
-    UInt64 txDescDoneCount;
-    UInt64 txDescDoneLast;
-    UInt32 txNextDescIndex;
-    UInt32 txDirtyDescIndex;
-    SInt32 txNumFreeDesc;
+    mbuf_t txPending;
+    mbuf_t txHiPending;
+    mbuf_t txHiPendingTail;
+    IOBufferMemoryDescriptor *txBounceDesc;
+    IOPhysicalAddress64 txBouncePhyAddr;
+    UInt8 *txBounceArray;
+    UInt32 txCopyThreshold;
+    UInt64 txDescDoneCount[kTxQueueCount];
+    UInt64 txDescDoneLast[kTxQueueCount];
+    RtlTxReclaimStats txReclaimStats;
+    UInt64 txReclaimDelay;
+    UInt32 txReclaimDescs;
+    UInt32 txReclaimHead[kTxQueueCount];
+    UInt32 txReclaimTail[kTxQueueCount];
+    RtlTxQueueStats txQueueStats[kTxQueueCount];
+    
+    /* Each tx ring has a single producer, outputStart(), which owns the next indices and a
+     * single consumer, txInterrupt(), which owns the dirty indices. Each side publishes its
+     * index with a release store and the number of free descriptors is derived from both.
+     */
+    UInt32 txNextDescIndex __attribute__((aligned(kCacheLineSize)));
+    UInt32 txHiNextDescIndex;
+    UInt32 txDirtyDescIndex __attribute__((aligned(kCacheLineSize)));
+    UInt32 txHiDirtyDescIndex;
     
     /* receiver data */
     IOBufferMemoryDescriptor *rxBufDesc;
@@ -311,6 +661,19 @@ private:
     UInt64 multicastFilter;
     UInt32 rxNextDescIndex;
     UInt32 rxConfigMask;
+    UInt32 rxPoolCount;
+    UInt32 rxCopybreak;
+    UInt32 rxBudget;
+    UInt32 rxCoalEvict;
+    RtlRxPoolStats rxPoolStats;
+    UInt32 rxFilterCount;
+    UInt32 rxFilterMcCount;
+    UInt32 rxFilterBcastCount;
+    UInt64 rxFilterMcHashDrops;
+    UInt64 rxFilterMcFallbackDrops;
+    bool rxFilterMcExact;
+    bool rxFilterMcTableValid;
+    bool rxFilterMcFallback;
     
     /* power management data */
     unsigned long powerState;
@@ -337,13 +700,23 @@ private:
     
     UInt16 intrMask;
     UInt16 intrMitigateValue;
+    RtlIntrModState intrMod;
+    RtlPollTuneState pollTune;
+#if ENABLE_PROFILER
+    RtlProfHist profHist[kProfCount];
+#endif
     UInt16 intrMaskRxTx;
     UInt16 intrMaskPoll;
     
     IONetworkPacketPollingParameters pollParams;
     
+    IOReturn (RTL8100::*outputStartFn)(IONetworkInterface *interface, IOOptionBits options);
+    UInt32 (RTL8100::*rxInterruptFn)(IONetworkInterface *interface, uint32_t maxCount, IOMbufQueue *pollQueue, void *context);
+    
     bool rxPoll;
     bool polling;
+    bool adaptivePoll;
+    bool pollTuning;
 
     /* flags */
     bool isEnabled;
@@ -359,8 +732,29 @@ private:
     bool enableCSO6;
     bool disableASPM;
     bool enableEEE;
+    bool adaptiveIntrMit;
+    bool linkChgIntr;
+    bool rxCoalescing;
+    bool rxBudgetPending;
+    bool txHiQueue;
     
     /* mbuf_t arrays */
     mbuf_t txMbufArray[kNumTxDesc];
+    mbuf_t txHiMbufArray[kNumTxHiDesc];
     mbuf_t rxMbufArray[kNumRxDesc];
+    
+    /* uptime in ns when a packet was posted, stored at its last descriptor */
+    UInt64 txPostTime[kNumTxDesc];
+    UInt64 txHiPostTime[kNumTxHiDesc];
+    
+    /* deferred tx reclaim queue */
+    RtlTxReclaimEntry txReclaimQueue[kTxQueueCount][kTxReclaimQueueSize];
+    RtlRxBuffer rxPool[kRxPoolSize];
+    RtlRxRefill rxRefill[kRxDescGroupSize];
+    
+    /* early rx filter program and its data */
+    RtlRxFilterRule rxFilterRules[kRxFilterMaxRules];
+    UInt64 rxFilterMcTable[kMCTableSize];
+    UInt32 rxFilterVlans[kRxFilterNumVlans / 32];
+    RtlRxCoalFlow rxCoalFlows[kRxCoalNumFlows];
 };
@@ -1323,6 +1323,63 @@ static inline u16 map_phy_ocp_addr(u16 PageNum, u8 RegNum)
     return OcpPhyAddress;
 }
 
+/*
+ * The access statistics are shared by all instances of the driver, as the
+ * accessors only get the register base. Different instances may update them
+ * concurrently, so the counters are incremented atomically.
+ */
+struct rtl8101_access_stats rtl8101_access_stats[RTL_ACCESS_COUNT];
+
+/*
+ * Waits for a register access to complete, i.e. until the flag bits in reg
+ * are set (set != 0) or cleared (set == 0). The register is checked after
+ * 1 µs first and the delay doubles up to RTL_POLL_MAX_STEP, so that fast
+ * accesses don't have to wait for a fixed 100 µs step. The total wait is
+ * bounded by timeout µs. The measured completion time is recorded in the
+ * accessor's histogram, as udelay() may take considerably longer than
+ * requested. Returns 0 on completion, -1 on timeout.
+ */
+static int
+rtl8101_wait_access(void __iomem *ioaddr,
+                    u32 reg,
+                    u32 flag,
+                    int set,
+                    u32 timeout,
+                    int type)
+{
+    struct rtl8101_access_stats *stats = &rtl8101_access_stats[type];
+    u64 start, now, waited;
+    u32 step = 1;
+    u32 bucket = 0;
+    int done;
+    
+    clock_get_uptime(&start);
+    
+    do {
+        udelay(step);
+        
+        if (step < RTL_POLL_MAX_STEP)
+            step <<= 1;
+        
+        done = set ? (RTL_R32(reg) & flag) : !(RTL_R32(reg) & flag);
+        
+        clock_get_uptime(&now);
+        absolutetime_to_nanoseconds(now - start, &waited);
+        waited /= 1000;
+    } while (!done && (waited < timeout));
+    
+    if (!done) {
+        OSIncrementAtomic(&stats->timeouts);
+        return -1;
+    }
+    while ((waited >>= 1) && (bucket < RTL_ACCESS_HIST_BUCKETS - 1))
+        bucket++;
+    
+    OSIncrementAtomic(&stats->hist[bucket]);
+    
+    return 0;
+}
+
 void mdio_write_phy_ocp(struct rtl8101_private *tp,
                                u16 PageNum,
                                u32 RegAddr,
@@ -1331,7 +1388,6 @@ void mdio_write_phy_ocp(struct rtl8101_private *tp,
     void __iomem *ioaddr = tp->mmio_addr;
     u32 data32;
     u16 ocp_addr;
-    int i;
     
     ocp_addr = map_phy_ocp_addr(PageNum, RegAddr);
     
@@ -1343,12 +1399,7 @@ void mdio_write_phy_ocp(struct rtl8101_private *tp,
     data32 |= OCPR_Write | value;
     
     RTL_W32(PHYOCP, data32);
-    for (i = 0; i < 100; i++) {
-        udelay(1);
-        
-        if (!(RTL_R32(PHYOCP) & OCPR_Flag))
-            break;
-    }
+    rtl8101_wait_access(ioaddr, PHYOCP, OCPR_Flag, 0, 100, RTL_ACCESS_MDIO);
 }
 
 static void mdio_real_write(struct rtl8101_private *tp,
@@ -1356,7 +1407,6 @@ static void mdio_real_write(struct rtl8101_private *tp,
                             u32 value)
 {
     void __iomem *ioaddr = tp->mmio_addr;
-    int i;
     
     if (RegAddr == 0x1F) {
         tp->cur_page = value;
@@ -1373,15 +1423,9 @@ static void mdio_real_write(struct rtl8101_private *tp,
                 (RegAddr & PHYAR_Reg_Mask) << PHYAR_Reg_shift |
                 (value & PHYAR_Data_Mask));
         
-        for (i = 0; i < 10; i++) {
-            udelay(100);
-            
-            /* Check if the RTL8101 has completed writing to the specified MII register */
-            if (!(RTL_R32(PHYAR) & PHYAR_Flag)) {
-                udelay(20);
-                break;
-            }
-        }
+        /* Wait until the RTL8101 has completed writing to the specified MII register. */
+        if (!rtl8101_wait_access(ioaddr, PHYAR, PHYAR_Flag, 0, RTL_POLL_TIMEOUT, RTL_ACCESS_MDIO))
+            udelay(20);
     }
 }
 
@@ -1441,7 +1485,7 @@ static u32 mdio_read_phy_ocp(struct rtl8101_private *tp,
     void __iomem *ioaddr = tp->mmio_addr;
     u32 data32;
     u16 ocp_addr;
-    int i, value = 0;
+    int value = 0;
     
     ocp_addr = map_phy_ocp_addr(PageNum, RegAddr);
     
@@ -1452,12 +1496,7 @@ static u32 mdio_read_phy_ocp(struct rtl8101_private *tp,
     data32 <<= OCPR_Addr_Reg_shift;
     
     RTL_W32(PHYOCP, data32);
-    for (i = 0; i < 100; i++) {
-        udelay(1);
-        
-        if (RTL_R32(PHYOCP) & OCPR_Flag)
-            break;
-    }
+    rtl8101_wait_access(ioaddr, PHYOCP, OCPR_Flag, 1, 100, RTL_ACCESS_MDIO);
     value = RTL_R32(PHYOCP) & OCPDR_Data_Mask;
     
     return value;
@@ -1467,7 +1506,7 @@ u32 mdio_read(struct rtl8101_private *tp,
               u32 RegAddr)
 {
     void __iomem *ioaddr = tp->mmio_addr;
-    int i, value = 0;
+    int value = 0;
     
     if (tp->mcfg == CFG_METHOD_17 || tp->mcfg == CFG_METHOD_18 ||
         tp->mcfg == CFG_METHOD_19) {
@@ -1476,15 +1515,10 @@ u32 mdio_read(struct rtl8101_private *tp,
         RTL_W32(PHYAR,
                 PHYAR_Read | (RegAddr & PHYAR_Reg_Mask) << PHYAR_Reg_shift);
         
-        for (i = 0; i < 10; i++) {
-            udelay(100);
-            
-            /* Check if the RTL8101 has completed retrieving data from the specified MII register */
-            if (RTL_R32(PHYAR) & PHYAR_Flag) {
-                value = RTL_R32(PHYAR) & PHYAR_Data_Mask;
-                udelay(20);
-                break;
-            }
+        /* Wait until the RTL8101 has completed retrieving data from the specified MII register. */
+        if (!rtl8101_wait_access(ioaddr, PHYAR, PHYAR_Flag, 1, RTL_POLL_TIMEOUT, RTL_ACCESS_MDIO)) {
+            value = RTL_R32(PHYAR) & PHYAR_Data_Mask;
+            udelay(20);
         }
     }
     
@@ -1562,19 +1596,12 @@ rtl8101_phyio_write(void __iomem *ioaddr,
                     int RegAddr,
                     int value)
 {
-    int i;
-    
     RTL_W32(PHYIO, PHYIO_Write |
             (RegAddr & PHYIO_Reg_Mask) << PHYIO_Reg_shift |
             (value & PHYIO_Data_Mask));
     
-    for (i = 0; i < 10; i++) {
-        udelay(100);
-        
-        /* Check if the RTL8101 has completed writing to the specified MII register */
-        if (!(RTL_R32(PHYIO) & PHYIO_Flag))
-            break;
-    }
+    /* Wait until the RTL8101 has completed writing to the specified MII register. */
+    rtl8101_wait_access(ioaddr, PHYIO, PHYIO_Flag, 0, RTL_POLL_TIMEOUT, RTL_ACCESS_PHYIO);
     
     udelay(100);
 }
@@ -1584,20 +1611,14 @@ static int
 rtl8101_phyio_read(void __iomem *ioaddr,
                    int RegAddr)
 {
-    int i, value = -1;
+    int value = -1;
     
     RTL_W32(PHYIO,
             PHYIO_Read | (RegAddr & PHYIO_Reg_Mask) << PHYIO_Reg_shift);
     
-    for (i = 0; i < 10; i++) {
-        udelay(100);
-        
-        /* Check if the RTL8101 has completed retrieving data from the specified MII register */
-        if (RTL_R32(PHYIO) & PHYIO_Flag) {
-            value = (int) (RTL_R32(PHYIO) & PHYIO_Data_Mask);
-            break;
-        }
-    }
+    /* Check if the RTL8101 has completed retrieving data from the specified MII register */
+    if (!rtl8101_wait_access(ioaddr, PHYIO, PHYIO_Flag, 1, RTL_POLL_TIMEOUT, RTL_ACCESS_PHYIO))
+        value = (int) (RTL_R32(PHYIO) & PHYIO_Data_Mask);
     
     udelay(100);
     
@@ -1607,41 +1628,27 @@ rtl8101_phyio_read(void __iomem *ioaddr,
 
 void rtl8101_ephy_write(void __iomem *ioaddr, u32 RegAddr, u32 value)
 {
-    int i;
-    
     RTL_W32(EPHYAR,
             EPHYAR_Write |
             (RegAddr & EPHYAR_Reg_Mask) << EPHYAR_Reg_shift |
             (value & EPHYAR_Data_Mask));
     
-    for (i = 0; i < 10; i++) {
-        udelay(100);
-        
-        /* Check if the RTL8101 has completed EPHY write */
-        if (!(RTL_R32(EPHYAR) & EPHYAR_Flag))
-            break;
-    }
+    /* Wait until the RTL8101 has completed the EPHY write. */
+    rtl8101_wait_access(ioaddr, EPHYAR, EPHYAR_Flag, 0, RTL_POLL_TIMEOUT, RTL_ACCESS_EPHY);
     
     udelay(20);
 }
 
 u16 rtl8101_ephy_read(void __iomem *ioaddr, u32 RegAddr)
 {
-    int i;
     u16 value = 0xffff;
     
     RTL_W32(EPHYAR,
             EPHYAR_Read | (RegAddr & EPHYAR_Reg_Mask) << EPHYAR_Reg_shift);
     
-    for (i = 0; i < 10; i++) {
-        udelay(100);
-        
-        /* Check if the RTL8101 has completed EPHY read */
-        if (RTL_R32(EPHYAR) & EPHYAR_Flag) {
-            value = (u16) (RTL_R32(EPHYAR) & EPHYAR_Data_Mask);
-            break;
-        }
-    }
+    /* Wait until the RTL8101 has completed the EPHY read. */
+    if (!rtl8101_wait_access(ioaddr, EPHYAR, EPHYAR_Flag, 1, RTL_POLL_TIMEOUT, RTL_ACCESS_EPHY))
+        value = (u16) (RTL_R32(EPHYAR) & EPHYAR_Data_Mask);
     
     udelay(20);
     
@@ -1839,7 +1846,7 @@ rtl8101_csi_fun0_write_byte(struct rtl8101_private *tp,
 
 u32 rtl8101_eri_read(void __iomem *ioaddr, int addr, int len, int type)
 {
-    int i, val_shift, shift = 0;
+    int val_shift, shift = 0;
     u32 value1 = 0, value2 = 0, mask;
     
     if (len > 4 || len <= 0)
@@ -1855,13 +1862,8 @@ u32 rtl8101_eri_read(void __iomem *ioaddr, int addr, int len, int type)
                 ERIAR_ByteEn << ERIAR_ByteEn_shift |
                 addr);
         
-        for (i = 0; i < 10; i++) {
-            udelay(100);
-            
-            /* Check if the RTL8101 has completed ERI read */
-            if (RTL_R32(ERIAR) & ERIAR_Flag)
-                break;
-        }
+        /* Wait until the RTL8101 has completed the ERI read. */
+        rtl8101_wait_access(ioaddr, ERIAR, ERIAR_Flag, 1, RTL_POLL_TIMEOUT, RTL_ACCESS_ERI);
         
         if (len == 1)		mask = (0xFF << (val_shift * 8)) & 0xFFFFFFFF;
         else if (len == 2)	mask = (0xFFFF << (val_shift * 8)) & 0xFFFFFFFF;
@@ -1888,7 +1890,7 @@ u32 rtl8101_eri_read(void __iomem *ioaddr, int addr, int len, int type)
 int rtl8101_eri_write(void __iomem *ioaddr, int addr, int len, u32 value, int type)
 {
     
-    int i, val_shift, shift = 0;
+    int val_shift, shift = 0;
     u32 value1 = 0, mask;
     
     if (len > 4 || len <= 0)
@@ -1913,13 +1915,8 @@ int rtl8101_eri_write(void __iomem *ioaddr, int addr, int len, u32 value, int ty
                 ERIAR_ByteEn << ERIAR_ByteEn_shift |
                 addr);
         
-        for (i = 0; i < 10; i++) {
-            udelay(100);
-            
-            /* Check if the RTL8101 has completed ERI write */
-            if (!(RTL_R32(ERIAR) & ERIAR_Flag))
-                break;
-        }
+        /* Wait until the RTL8101 has completed the ERI write. */
+        rtl8101_wait_access(ioaddr, ERIAR, ERIAR_Flag, 0, RTL_POLL_TIMEOUT, RTL_ACCESS_ERI);
         
         if (len <= 4 - val_shift)
             len = 0;
@@ -5084,3153 +5081,3229 @@ rtl8101_write_hw_phy_mcu_code_ver(struct net_device *dev)
     }
 }
 
+/*
+ * PHY patches are kept as tables of operations which are run by
+ * rtl8101_run_phy_patch() instead of long sequences of inline mdio_write()
+ * calls.
+ */
+enum rtl8101_phy_patch_opcode {
+    PHY_OP_WRITE = 0,       /* write value to reg */
+    PHY_OP_SET_BITS,        /* set the bits given in value in reg */
+    PHY_OP_CLEAR_BITS,      /* clear the bits given in value in reg */
+    PHY_OP_POLL,            /* wait until (reg & mask) == value, arg is the timeout in ms */
+    PHY_OP_SKIP_IF_CLEAR,   /* skip the next arg ops if (reg & mask) == 0 */
+    PHY_OP_DELAY,           /* wait arg ms */
+    PHY_OP_END
+};
+
+struct rtl8101_phy_patch_op {
+    u8 op;
+    u8 reg;
+    u16 value;
+    u16 mask;
+    u16 arg;
+};
+
+#define PHY_W(reg, value)               { PHY_OP_WRITE, (reg), (value), 0, 0 }
+#define PHY_SET(reg, bits)              { PHY_OP_SET_BITS, (reg), (bits), 0, 0 }
+#define PHY_CLR(reg, bits)              { PHY_OP_CLEAR_BITS, (reg), (bits), 0, 0 }
+#define PHY_POLL(reg, mask, value, ms)  { PHY_OP_POLL, (reg), (value), (mask), (ms) }
+#define PHY_SKIP_IF_CLEAR(reg, mask, n) { PHY_OP_SKIP_IF_CLEAR, (reg), 0, (mask), (n) }
+#define PHY_DELAY(ms)                   { PHY_OP_DELAY, 0, 0, 0, (ms) }
+#define PHY_END                         { PHY_OP_END, 0, 0, 0, 0 }
+
+/* Completion flags are polled in steps of this many microseconds. */
+#define PHY_PATCH_POLL_STEP     2
+
+#ifdef RTL8101_DEBUG
+/*
+ * Counts the MDIO accesses of a patch table and sums up the worst case time
+ * spent waiting in poll and delay operations. Only used for debug output.
+ */
 static void
-rtl8101_set_phy_mcu_8105e_1(struct net_device *dev)
+rtl8101_phy_patch_cost(const struct rtl8101_phy_patch_op *patch,
+                       u32 *writes,
+                       u32 *reads,
+                       u32 *worst_case_ms)
 {
-    struct rtl8101_private *tp = netdev_priv(dev);
-    unsigned int gphy_val,i;
+    const struct rtl8101_phy_patch_op *op;
     
-    mdio_write(tp, 0x1f, 0x0000);
-    mdio_write(tp, 0x00, 0x1800);
-    mdio_write(tp, 0x1f, 0x0007);
-    mdio_write(tp, 0x1e, 0x0023);
-    mdio_write(tp, 0x17, 0x0117);
-    mdio_write(tp, 0x1f, 0x0007);
-    mdio_write(tp, 0x1E, 0x002C);
-    mdio_write(tp, 0x1B, 0x5000);
-    mdio_write(tp, 0x1f, 0x0000);
-    mdio_write(tp, 0x16, 0x4104);
-    for (i = 0; i < 200; i++) {
-        udelay(100);
-        gphy_val = mdio_read(tp, 0x1E);
-        gphy_val &= 0x03FF;
-        if (gphy_val==0x000C)
-            break;
+    *writes = *reads = *worst_case_ms = 0;
+    
+    for (op = patch; op->op != PHY_OP_END; op++) {
+        switch (op->op) {
+            case PHY_OP_WRITE:
+                (*writes)++;
+                break;
+            case PHY_OP_SET_BITS:
+            case PHY_OP_CLEAR_BITS:
+                (*reads)++;
+                (*writes)++;
+                break;
+            case PHY_OP_POLL:
+                (*reads)++;
+                *worst_case_ms += op->arg;
+                break;
+            case PHY_OP_SKIP_IF_CLEAR:
+                (*reads)++;
+                break;
+            case PHY_OP_DELAY:
+                *worst_case_ms += op->arg;
+                break;
+        }
     }
-    mdio_write(tp, 0x1f, 0x0005);
-    for (i = 0; i < 200; i++) {
-        udelay(100);
-        gphy_val = mdio_read(tp, 0x07);
-        if ((gphy_val & BIT_5)==0)
-            break;
-    }
-    gphy_val = mdio_read(tp, 0x07);
-    if (gphy_val & BIT_5) {
-        mdio_write(tp, 0x1f, 0x0007);
-        mdio_write(tp, 0x1e, 0x00a1);
-        mdio_write(tp, 0x17, 0x1000);
-        mdio_write(tp, 0x17, 0x0000);
-        mdio_write(tp, 0x17, 0x2000);
-        mdio_write(tp, 0x1e, 0x002f);
-        mdio_write(tp, 0x18, 0x9bfb);
-        mdio_write(tp, 0x1f, 0x0005);
-        mdio_write(tp, 0x07, 0x0000);
-        mdio_write(tp, 0x1f, 0x0000);
+}
+#endif /* RTL8101_DEBUG */
+
+static void
+rtl8101_run_phy_patch(struct rtl8101_private *tp,
+                      const struct rtl8101_phy_patch_op *patch)
+{
+    const struct rtl8101_phy_patch_op *op;
+    u64 deadline, now;
+#ifdef RTL8101_DEBUG
+    u64 start;
+    u32 writes, reads, worst_case_ms;
+    
+    clock_get_uptime(&start);
+#endif
+    
+    for (op = patch; op->op != PHY_OP_END; op++) {
+        switch (op->op) {
+            case PHY_OP_WRITE:
+                mdio_write(tp, op->reg, op->value);
+                break;
+            case PHY_OP_SET_BITS:
+                mdio_write(tp, op->reg, mdio_read(tp, op->reg) | op->value);
+                break;
+            case PHY_OP_CLEAR_BITS:
+                mdio_write(tp, op->reg, mdio_read(tp, op->reg) & ~op->value);
+                break;
+            case PHY_OP_POLL:
+                clock_interval_to_deadline(op->arg, kMillisecondScale, &deadline);
+    
+                do {
+                    udelay(PHY_PATCH_POLL_STEP);
+    
+                    if ((mdio_read(tp, op->reg) & op->mask) == op->value)
+                        break;
+    
+                    clock_get_uptime(&now);
+                } while (now < deadline);
+                break;
+            case PHY_OP_SKIP_IF_CLEAR:
+                if (!(mdio_read(tp, op->reg) & op->mask))
+                    op += op->arg;
+                break;
+            case PHY_OP_DELAY:
+                mdelay(op->arg);
+                break;
+        }
     }
-    mdio_write(tp, 0x1f, 0x0005);
-    mdio_write(tp, 0x05, 0xfff6);
-    mdio_write(tp, 0x06, 0x0080);
-    gphy_val = mdio_read(tp, 0x00);
-    gphy_val &= ~(BIT_7);
-    mdio_write(tp, 0x00, gphy_val);
-    mdio_write(tp, 0x1f, 0x0002);
-    gphy_val = mdio_read(tp, 0x08);
-    gphy_val &= ~(BIT_7);
-    mdio_write(tp, 0x08, gphy_val);
-    mdio_write(tp, 0x1f, 0x0000);
-    mdio_write(tp, 0x1f, 0x0007);
-    mdio_write(tp, 0x1e, 0x0023);
-    mdio_write(tp, 0x16, 0x0306);
-    mdio_write(tp, 0x16, 0x0307);
-    mdio_write(tp, 0x15, 0x000e);
-    mdio_write(tp, 0x19, 0x000a);
-    mdio_write(tp, 0x15, 0x0010);
-    mdio_write(tp, 0x19, 0x0008);
-    mdio_write(tp, 0x15, 0x0018);
-    mdio_write(tp, 0x19, 0x4801);
-    mdio_write(tp, 0x15, 0x0019);
-    mdio_write(tp, 0x19, 0x6801);
-    mdio_write(tp, 0x15, 0x001a);
-    mdio_write(tp, 0x19, 0x66a1);
-    mdio_write(tp, 0x15, 0x001f);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0020);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0021);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0022);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0023);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0024);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0025);
-    mdio_write(tp, 0x19, 0x64a1);
-    mdio_write(tp, 0x15, 0x0026);
-    mdio_write(tp, 0x19, 0x40ea);
-    mdio_write(tp, 0x15, 0x0027);
-    mdio_write(tp, 0x19, 0x4503);
-    mdio_write(tp, 0x15, 0x0028);
-    mdio_write(tp, 0x19, 0x9f00);
-    mdio_write(tp, 0x15, 0x0029);
-    mdio_write(tp, 0x19, 0xa631);
-    mdio_write(tp, 0x15, 0x002a);
-    mdio_write(tp, 0x19, 0x9717);
-    mdio_write(tp, 0x15, 0x002b);
-    mdio_write(tp, 0x19, 0x302c);
-    mdio_write(tp, 0x15, 0x002c);
-    mdio_write(tp, 0x19, 0x4802);
-    mdio_write(tp, 0x15, 0x002d);
-    mdio_write(tp, 0x19, 0x58da);
-    mdio_write(tp, 0x15, 0x002e);
-    mdio_write(tp, 0x19, 0x400d);
-    mdio_write(tp, 0x15, 0x002f);
-    mdio_write(tp, 0x19, 0x4488);
-    mdio_write(tp, 0x15, 0x0030);
-    mdio_write(tp, 0x19, 0x9e00);
-    mdio_write(tp, 0x15, 0x0031);
-    mdio_write(tp, 0x19, 0x63c8);
-    mdio_write(tp, 0x15, 0x0032);
-    mdio_write(tp, 0x19, 0x6481);
-    mdio_write(tp, 0x15, 0x0033);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0034);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0035);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0036);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0037);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0038);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0039);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x003a);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x003b);
-    mdio_write(tp, 0x19, 0x63e8);
-    mdio_write(tp, 0x15, 0x003c);
-    mdio_write(tp, 0x19, 0x7d00);
-    mdio_write(tp, 0x15, 0x003d);
-    mdio_write(tp, 0x19, 0x59d4);
-    mdio_write(tp, 0x15, 0x003e);
-    mdio_write(tp, 0x19, 0x63f8);
-    mdio_write(tp, 0x15, 0x0040);
-    mdio_write(tp, 0x19, 0x64a1);
-    mdio_write(tp, 0x15, 0x0041);
-    mdio_write(tp, 0x19, 0x30de);
-    mdio_write(tp, 0x15, 0x0044);
-    mdio_write(tp, 0x19, 0x480f);
-    mdio_write(tp, 0x15, 0x0045);
-    mdio_write(tp, 0x19, 0x6800);
-    mdio_write(tp, 0x15, 0x0046);
-    mdio_write(tp, 0x19, 0x6680);
-    mdio_write(tp, 0x15, 0x0047);
-    mdio_write(tp, 0x19, 0x7c10);
-    mdio_write(tp, 0x15, 0x0048);
-    mdio_write(tp, 0x19, 0x63c8);
-    mdio_write(tp, 0x15, 0x0049);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x004a);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x004b);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x004c);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x004d);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x004e);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x004f);
-    mdio_write(tp, 0x19, 0x40ea);
-    mdio_write(tp, 0x15, 0x0050);
-    mdio_write(tp, 0x19, 0x4503);
-    mdio_write(tp, 0x15, 0x0051);
-    mdio_write(tp, 0x19, 0x58ca);
-    mdio_write(tp, 0x15, 0x0052);
-    mdio_write(tp, 0x19, 0x63c8);
-    mdio_write(tp, 0x15, 0x0053);
-    mdio_write(tp, 0x19, 0x63d8);
-    mdio_write(tp, 0x15, 0x0054);
-    mdio_write(tp, 0x19, 0x66a0);
-    mdio_write(tp, 0x15, 0x0055);
-    mdio_write(tp, 0x19, 0x9f00);
-    mdio_write(tp, 0x15, 0x0056);
-    mdio_write(tp, 0x19, 0x3000);
-    mdio_write(tp, 0x15, 0x006E);
-    mdio_write(tp, 0x19, 0x9afa);
-    mdio_write(tp, 0x15, 0x00a1);
-    mdio_write(tp, 0x19, 0x3044);
-    mdio_write(tp, 0x15, 0x00ab);
-    mdio_write(tp, 0x19, 0x5820);
-    mdio_write(tp, 0x15, 0x00ac);
-    mdio_write(tp, 0x19, 0x5e04);
-    mdio_write(tp, 0x15, 0x00ad);
-    mdio_write(tp, 0x19, 0xb60c);
-    mdio_write(tp, 0x15, 0x00af);
-    mdio_write(tp, 0x19, 0x000a);
-    mdio_write(tp, 0x15, 0x00b2);
-    mdio_write(tp, 0x19, 0x30b9);
-    mdio_write(tp, 0x15, 0x00b9);
-    mdio_write(tp, 0x19, 0x4408);
-    mdio_write(tp, 0x15, 0x00ba);
-    mdio_write(tp, 0x19, 0x480b);
-    mdio_write(tp, 0x15, 0x00bb);
-    mdio_write(tp, 0x19, 0x5e00);
-    mdio_write(tp, 0x15, 0x00bc);
-    mdio_write(tp, 0x19, 0x405f);
-    mdio_write(tp, 0x15, 0x00bd);
-    mdio_write(tp, 0x19, 0x4448);
-    mdio_write(tp, 0x15, 0x00be);
-    mdio_write(tp, 0x19, 0x4020);
-    mdio_write(tp, 0x15, 0x00bf);
-    mdio_write(tp, 0x19, 0x4468);
-    mdio_write(tp, 0x15, 0x00c0);
-    mdio_write(tp, 0x19, 0x9c02);
-    mdio_write(tp, 0x15, 0x00c1);
-    mdio_write(tp, 0x19, 0x58a0);
-    mdio_write(tp, 0x15, 0x00c2);
-    mdio_write(tp, 0x19, 0xb605);
-    mdio_write(tp, 0x15, 0x00c3);
-    mdio_write(tp, 0x19, 0xc0d3);
-    mdio_write(tp, 0x15, 0x00c4);
-    mdio_write(tp, 0x19, 0x00e6);
-    mdio_write(tp, 0x15, 0x00c5);
-    mdio_write(tp, 0x19, 0xdaec);
-    mdio_write(tp, 0x15, 0x00c6);
-    mdio_write(tp, 0x19, 0x00fa);
-    mdio_write(tp, 0x15, 0x00c7);
-    mdio_write(tp, 0x19, 0x9df9);
-    mdio_write(tp, 0x15, 0x00c8);
-    mdio_write(tp, 0x19, 0x307a);
-    mdio_write(tp, 0x15, 0x0112);
-    mdio_write(tp, 0x19, 0x6421);
-    mdio_write(tp, 0x15, 0x0113);
-    mdio_write(tp, 0x19, 0x7c08);
-    mdio_write(tp, 0x15, 0x0114);
-    mdio_write(tp, 0x19, 0x63f0);
-    mdio_write(tp, 0x15, 0x0115);
-    mdio_write(tp, 0x19, 0x4003);
-    mdio_write(tp, 0x15, 0x0116);
-    mdio_write(tp, 0x19, 0x4418);
-    mdio_write(tp, 0x15, 0x0117);
-    mdio_write(tp, 0x19, 0x9b00);
-    mdio_write(tp, 0x15, 0x0118);
-    mdio_write(tp, 0x19, 0x6461);
-    mdio_write(tp, 0x15, 0x0119);
-    mdio_write(tp, 0x19, 0x64e1);
-    mdio_write(tp, 0x15, 0x011a);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0150);
-    mdio_write(tp, 0x19, 0x6461);
-    mdio_write(tp, 0x15, 0x0151);
-    mdio_write(tp, 0x19, 0x4003);
-    mdio_write(tp, 0x15, 0x0152);
-    mdio_write(tp, 0x19, 0x4540);
-    mdio_write(tp, 0x15, 0x0153);
-    mdio_write(tp, 0x19, 0x9f00);
-    mdio_write(tp, 0x15, 0x0155);
-    mdio_write(tp, 0x19, 0x6421);
-    mdio_write(tp, 0x15, 0x0156);
-    mdio_write(tp, 0x19, 0x64a1);
-    mdio_write(tp, 0x15, 0x021e);
-    mdio_write(tp, 0x19, 0x5410);
-    mdio_write(tp, 0x15, 0x0225);
-    mdio_write(tp, 0x19, 0x5400);
-    mdio_write(tp, 0x15, 0x023D);
-    mdio_write(tp, 0x19, 0x4050);
-    mdio_write(tp, 0x15, 0x0295);
-    mdio_write(tp, 0x19, 0x6c08);
-    mdio_write(tp, 0x15, 0x02bd);
-    mdio_write(tp, 0x19, 0xa523);
-    mdio_write(tp, 0x15, 0x02be);
-    mdio_write(tp, 0x19, 0x32ca);
-    mdio_write(tp, 0x15, 0x02ca);
-    mdio_write(tp, 0x19, 0x48b3);
-    mdio_write(tp, 0x15, 0x02cb);
-    mdio_write(tp, 0x19, 0x4020);
-    mdio_write(tp, 0x15, 0x02cc);
-    mdio_write(tp, 0x19, 0x4823);
-    mdio_write(tp, 0x15, 0x02cd);
-    mdio_write(tp, 0x19, 0x4510);
-    mdio_write(tp, 0x15, 0x02ce);
-    mdio_write(tp, 0x19, 0xb63a);
-    mdio_write(tp, 0x15, 0x02cf);
-    mdio_write(tp, 0x19, 0x7dc8);
-    mdio_write(tp, 0x15, 0x02d6);
-    mdio_write(tp, 0x19, 0x9bf8);
-    mdio_write(tp, 0x15, 0x02d8);
-    mdio_write(tp, 0x19, 0x85f6);
-    mdio_write(tp, 0x15, 0x02d9);
-    mdio_write(tp, 0x19, 0x32e0);
-    mdio_write(tp, 0x15, 0x02e0);
-    mdio_write(tp, 0x19, 0x4834);
-    mdio_write(tp, 0x15, 0x02e1);
-    mdio_write(tp, 0x19, 0x6c08);
-    mdio_write(tp, 0x15, 0x02e2);
-    mdio_write(tp, 0x19, 0x4020);
-    mdio_write(tp, 0x15, 0x02e3);
-    mdio_write(tp, 0x19, 0x4824);
-    mdio_write(tp, 0x15, 0x02e4);
-    mdio_write(tp, 0x19, 0x4520);
-    mdio_write(tp, 0x15, 0x02e5);
-    mdio_write(tp, 0x19, 0x4008);
-    mdio_write(tp, 0x15, 0x02e6);
-    mdio_write(tp, 0x19, 0x4560);
-    mdio_write(tp, 0x15, 0x02e7);
-    mdio_write(tp, 0x19, 0x9d04);
-    mdio_write(tp, 0x15, 0x02e8);
-    mdio_write(tp, 0x19, 0x48c4);
-    mdio_write(tp, 0x15, 0x02e9);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x02ea);
-    mdio_write(tp, 0x19, 0x4844);
-    mdio_write(tp, 0x15, 0x02eb);
-    mdio_write(tp, 0x19, 0x7dc8);
-    mdio_write(tp, 0x15, 0x02f0);
-    mdio_write(tp, 0x19, 0x9cf7);
-    mdio_write(tp, 0x15, 0x02f1);
-    mdio_write(tp, 0x19, 0xdf94);
-    mdio_write(tp, 0x15, 0x02f2);
-    mdio_write(tp, 0x19, 0x0002);
-    mdio_write(tp, 0x15, 0x02f3);
-    mdio_write(tp, 0x19, 0x6810);
-    mdio_write(tp, 0x15, 0x02f4);
-    mdio_write(tp, 0x19, 0xb614);
-    mdio_write(tp, 0x15, 0x02f5);
-    mdio_write(tp, 0x19, 0xc42b);
-    mdio_write(tp, 0x15, 0x02f6);
-    mdio_write(tp, 0x19, 0x00d4);
-    mdio_write(tp, 0x15, 0x02f7);
-    mdio_write(tp, 0x19, 0xc455);
-    mdio_write(tp, 0x15, 0x02f8);
-    mdio_write(tp, 0x19, 0x0093);
-    mdio_write(tp, 0x15, 0x02f9);
-    mdio_write(tp, 0x19, 0x92ee);
-    mdio_write(tp, 0x15, 0x02fa);
-    mdio_write(tp, 0x19, 0xefed);
-    mdio_write(tp, 0x15, 0x02fb);
-    mdio_write(tp, 0x19, 0x3312);
-    mdio_write(tp, 0x15, 0x0312);
-    mdio_write(tp, 0x19, 0x49b5);
-    mdio_write(tp, 0x15, 0x0313);
-    mdio_write(tp, 0x19, 0x7d00);
-    mdio_write(tp, 0x15, 0x0314);
-    mdio_write(tp, 0x19, 0x4d00);
-    mdio_write(tp, 0x15, 0x0315);
-    mdio_write(tp, 0x19, 0x6810);
-    mdio_write(tp, 0x15, 0x031e);
-    mdio_write(tp, 0x19, 0x404f);
-    mdio_write(tp, 0x15, 0x031f);
-    mdio_write(tp, 0x19, 0x44c8);
-    mdio_write(tp, 0x15, 0x0320);
-    mdio_write(tp, 0x19, 0xd64f);
-    mdio_write(tp, 0x15, 0x0321);
-    mdio_write(tp, 0x19, 0x00e7);
-    mdio_write(tp, 0x15, 0x0322);
-    mdio_write(tp, 0x19, 0x7c08);
-    mdio_write(tp, 0x15, 0x0323);
-    mdio_write(tp, 0x19, 0x8203);
-    mdio_write(tp, 0x15, 0x0324);
-    mdio_write(tp, 0x19, 0x4d48);
-    mdio_write(tp, 0x15, 0x0325);
-    mdio_write(tp, 0x19, 0x3327);
-    mdio_write(tp, 0x15, 0x0326);
-    mdio_write(tp, 0x19, 0x4d40);
-    mdio_write(tp, 0x15, 0x0327);
-    mdio_write(tp, 0x19, 0xc8d7);
-    mdio_write(tp, 0x15, 0x0328);
-    mdio_write(tp, 0x19, 0x0003);
-    mdio_write(tp, 0x15, 0x0329);
-    mdio_write(tp, 0x19, 0x7c20);
-    mdio_write(tp, 0x15, 0x032a);
-    mdio_write(tp, 0x19, 0x4c20);
-    mdio_write(tp, 0x15, 0x032b);
-    mdio_write(tp, 0x19, 0xc8ed);
-    mdio_write(tp, 0x15, 0x032c);
-    mdio_write(tp, 0x19, 0x00f4);
-    mdio_write(tp, 0x15, 0x032d);
-    mdio_write(tp, 0x19, 0x82b3);
-    mdio_write(tp, 0x15, 0x032e);
-    mdio_write(tp, 0x19, 0xd11d);
-    mdio_write(tp, 0x15, 0x032f);
-    mdio_write(tp, 0x19, 0x00b1);
-    mdio_write(tp, 0x15, 0x0330);
-    mdio_write(tp, 0x19, 0xde18);
-    mdio_write(tp, 0x15, 0x0331);
-    mdio_write(tp, 0x19, 0x0008);
-    mdio_write(tp, 0x15, 0x0332);
-    mdio_write(tp, 0x19, 0x91ee);
-    mdio_write(tp, 0x15, 0x0333);
-    mdio_write(tp, 0x19, 0x3339);
-    mdio_write(tp, 0x15, 0x033a);
-    mdio_write(tp, 0x19, 0x4064);
-    mdio_write(tp, 0x15, 0x0340);
-    mdio_write(tp, 0x19, 0x9e06);
-    mdio_write(tp, 0x15, 0x0341);
-    mdio_write(tp, 0x19, 0x7c08);
-    mdio_write(tp, 0x15, 0x0342);
-    mdio_write(tp, 0x19, 0x8203);
-    mdio_write(tp, 0x15, 0x0343);
-    mdio_write(tp, 0x19, 0x4d48);
-    mdio_write(tp, 0x15, 0x0344);
-    mdio_write(tp, 0x19, 0x3346);
-    mdio_write(tp, 0x15, 0x0345);
-    mdio_write(tp, 0x19, 0x4d40);
-    mdio_write(tp, 0x15, 0x0346);
-    mdio_write(tp, 0x19, 0xd11d);
-    mdio_write(tp, 0x15, 0x0347);
-    mdio_write(tp, 0x19, 0x0099);
-    mdio_write(tp, 0x15, 0x0348);
-    mdio_write(tp, 0x19, 0xbb17);
-    mdio_write(tp, 0x15, 0x0349);
-    mdio_write(tp, 0x19, 0x8102);
-    mdio_write(tp, 0x15, 0x034a);
-    mdio_write(tp, 0x19, 0x334d);
-    mdio_write(tp, 0x15, 0x034b);
-    mdio_write(tp, 0x19, 0xa22c);
-    mdio_write(tp, 0x15, 0x034c);
-    mdio_write(tp, 0x19, 0x3397);
-    mdio_write(tp, 0x15, 0x034d);
-    mdio_write(tp, 0x19, 0x91f2);
-    mdio_write(tp, 0x15, 0x034e);
-    mdio_write(tp, 0x19, 0xc218);
-    mdio_write(tp, 0x15, 0x034f);
-    mdio_write(tp, 0x19, 0x00f0);
-    mdio_write(tp, 0x15, 0x0350);
-    mdio_write(tp, 0x19, 0x3397);
-    mdio_write(tp, 0x15, 0x0351);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0364);
-    mdio_write(tp, 0x19, 0xbc05);
-    mdio_write(tp, 0x15, 0x0367);
-    mdio_write(tp, 0x19, 0xa1fc);
-    mdio_write(tp, 0x15, 0x0368);
-    mdio_write(tp, 0x19, 0x3377);
-    mdio_write(tp, 0x15, 0x0369);
-    mdio_write(tp, 0x19, 0x328b);
-    mdio_write(tp, 0x15, 0x036a);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x15, 0x0377);
-    mdio_write(tp, 0x19, 0x4b97);
-    mdio_write(tp, 0x15, 0x0378);
-    mdio_write(tp, 0x19, 0x6818);
-    mdio_write(tp, 0x15, 0x0379);
-    mdio_write(tp, 0x19, 0x4b07);
-    mdio_write(tp, 0x15, 0x037a);
-    mdio_write(tp, 0x19, 0x40ac);
-    mdio_write(tp, 0x15, 0x037b);
-    mdio_write(tp, 0x19, 0x4445);
-    mdio_write(tp, 0x15, 0x037c);
-    mdio_write(tp, 0x19, 0x404e);
-    mdio_write(tp, 0x15, 0x037d);
-    mdio_write(tp, 0x19, 0x4461);
-    mdio_write(tp, 0x15, 0x037e);
-    mdio_write(tp, 0x19, 0x9c09);
-    mdio_write(tp, 0x15, 0x037f);
-    mdio_write(tp, 0x19, 0x63da);
-    mdio_write(tp, 0x15, 0x0380);
-    mdio_write(tp, 0x19, 0x5440);
-    mdio_write(tp, 0x15, 0x0381);
-    mdio_write(tp, 0x19, 0x4b98);
-    mdio_write(tp, 0x15, 0x0382);
-    mdio_write(tp, 0x19, 0x7c60);
-    mdio_write(tp, 0x15, 0x0383);
-    mdio_write(tp, 0x19, 0x4c00);
-    mdio_write(tp, 0x15, 0x0384);
-    mdio_write(tp, 0x19, 0x4b08);
-    mdio_write(tp, 0x15, 0x0385);
-    mdio_write(tp, 0x19, 0x63d8);
-    mdio_write(tp, 0x15, 0x0386);
-    mdio_write(tp, 0x19, 0x338d);
-    mdio_write(tp, 0x15, 0x0387);
-    mdio_write(tp, 0x19, 0xd64f);
-    mdio_write(tp, 0x15, 0x0388);
-    mdio_write(tp, 0x19, 0x0080);
-    mdio_write(tp, 0x15, 0x0389);
-    mdio_write(tp, 0x19, 0x820c);
-    mdio_write(tp, 0x15, 0x038a);
-    mdio_write(tp, 0x19, 0xa10b);
-    mdio_write(tp, 0x15, 0x038b);
-    mdio_write(tp, 0x19, 0x9df3);
-    mdio_write(tp, 0x15, 0x038c);
-    mdio_write(tp, 0x19, 0x3395);
-    mdio_write(tp, 0x15, 0x038d);
-    mdio_write(tp, 0x19, 0xd64f);
-    mdio_write(tp, 0x15, 0x038e);
-    mdio_write(tp, 0x19, 0x00f9);
-    mdio_write(tp, 0x15, 0x038f);
-    mdio_write(tp, 0x19, 0xc017);
-    mdio_write(tp, 0x15, 0x0390);
-    mdio_write(tp, 0x19, 0x0005);
-    mdio_write(tp, 0x15, 0x0391);
-    mdio_write(tp, 0x19, 0x6c0b);
-    mdio_write(tp, 0x15, 0x0392);
-    mdio_write(tp, 0x19, 0xa103);
-    mdio_write(tp, 0x15, 0x0393);
-    mdio_write(tp, 0x19, 0x6c08);
-    mdio_write(tp, 0x15, 0x0394);
-    mdio_write(tp, 0x19, 0x9df9);
-    mdio_write(tp, 0x15, 0x0395);
-    mdio_write(tp, 0x19, 0x6c08);
-    mdio_write(tp, 0x15, 0x0396);
-    mdio_write(tp, 0x19, 0x3397);
-    mdio_write(tp, 0x15, 0x0399);
-    mdio_write(tp, 0x19, 0x6810);
-    mdio_write(tp, 0x15, 0x03a4);
-    mdio_write(tp, 0x19, 0x7c08);
-    mdio_write(tp, 0x15, 0x03a5);
-    mdio_write(tp, 0x19, 0x8203);
-    mdio_write(tp, 0x15, 0x03a6);
-    mdio_write(tp, 0x19, 0x4d08);
-    mdio_write(tp, 0x15, 0x03a7);
-    mdio_write(tp, 0x19, 0x33a9);
-    mdio_write(tp, 0x15, 0x03a8);
-    mdio_write(tp, 0x19, 0x4d00);
-    mdio_write(tp, 0x15, 0x03a9);
-    mdio_write(tp, 0x19, 0x9bfa);
-    mdio_write(tp, 0x15, 0x03aa);
-    mdio_write(tp, 0x19, 0x33b6);
-    mdio_write(tp, 0x15, 0x03bb);
-    mdio_write(tp, 0x19, 0x4056);
-    mdio_write(tp, 0x15, 0x03bc);
-    mdio_write(tp, 0x19, 0x44e9);
-    mdio_write(tp, 0x15, 0x03bd);
-    mdio_write(tp, 0x19, 0x4054);
-    mdio_write(tp, 0x15, 0x03be);
-    mdio_write(tp, 0x19, 0x44f8);
-    mdio_write(tp, 0x15, 0x03bf);
-    mdio_write(tp, 0x19, 0xd64f);
-    mdio_write(tp, 0x15, 0x03c0);
-    mdio_write(tp, 0x19, 0x0037);
-    mdio_write(tp, 0x15, 0x03c1);
-    mdio_write(tp, 0x19, 0xbd37);
-    mdio_write(tp, 0x15, 0x03c2);
-    mdio_write(tp, 0x19, 0x9cfd);
-    mdio_write(tp, 0x15, 0x03c3);
-    mdio_write(tp, 0x19, 0xc639);
-    mdio_write(tp, 0x15, 0x03c4);
-    mdio_write(tp, 0x19, 0x0011);
-    mdio_write(tp, 0x15, 0x03c5);
-    mdio_write(tp, 0x19, 0x9b03);
-    mdio_write(tp, 0x15, 0x03c6);
-    mdio_write(tp, 0x19, 0x7c01);
-    mdio_write(tp, 0x15, 0x03c7);
-    mdio_write(tp, 0x19, 0x4c01);
-    mdio_write(tp, 0x15, 0x03c8);
-    mdio_write(tp, 0x19, 0x9e03);
-    mdio_write(tp, 0x15, 0x03c9);
-    mdio_write(tp, 0x19, 0x7c20);
-    mdio_write(tp, 0x15, 0x03ca);
-    mdio_write(tp, 0x19, 0x4c20);
-    mdio_write(tp, 0x15, 0x03cb);
-    mdio_write(tp, 0x19, 0x9af4);
-    mdio_write(tp, 0x15, 0x03cc);
-    mdio_write(tp, 0x19, 0x7c12);
-    mdio_write(tp, 0x15, 0x03cd);
-    mdio_write(tp, 0x19, 0x4c52);
-    mdio_write(tp, 0x15, 0x03ce);
-    mdio_write(tp, 0x19, 0x4470);
-    mdio_write(tp, 0x15, 0x03cf);
-    mdio_write(tp, 0x19, 0x7c12);
-    mdio_write(tp, 0x15, 0x03d0);
-    mdio_write(tp, 0x19, 0x4c40);
-    mdio_write(tp, 0x15, 0x03d1);
-    mdio_write(tp, 0x19, 0x33bf);
-    mdio_write(tp, 0x15, 0x03d6);
-    mdio_write(tp, 0x19, 0x4047);
-    mdio_write(tp, 0x15, 0x03d7);
-    mdio_write(tp, 0x19, 0x4469);
-    mdio_write(tp, 0x15, 0x03d8);
-    mdio_write(tp, 0x19, 0x492b);
-    mdio_write(tp, 0x15, 0x03d9);
-    mdio_write(tp, 0x19, 0x4479);
-    mdio_write(tp, 0x15, 0x03da);
-    mdio_write(tp, 0x19, 0x7c09);
-    mdio_write(tp, 0x15, 0x03db);
-    mdio_write(tp, 0x19, 0x8203);
-    mdio_write(tp, 0x15, 0x03dc);
-    mdio_write(tp, 0x19, 0x4d48);
-    mdio_write(tp, 0x15, 0x03dd);
-    mdio_write(tp, 0x19, 0x33df);
-    mdio_write(tp, 0x15, 0x03de);
-    mdio_write(tp, 0x19, 0x4d40);
-    mdio_write(tp, 0x15, 0x03df);
-    mdio_write(tp, 0x19, 0xd64f);
-    mdio_write(tp, 0x15, 0x03e0);
-    mdio_write(tp, 0x19, 0x0017);
-    mdio_write(tp, 0x15, 0x03e1);
-    mdio_write(tp, 0x19, 0xbd17);
-    mdio_write(tp, 0x15, 0x03e2);
-    mdio_write(tp, 0x19, 0x9b03);
-    mdio_write(tp, 0x15, 0x03e3);
-    mdio_write(tp, 0x19, 0x7c20);
-    mdio_write(tp, 0x15, 0x03e4);
-    mdio_write(tp, 0x19, 0x4c20);
-    mdio_write(tp, 0x15, 0x03e5);
-    mdio_write(tp, 0x19, 0x88f5);
-    mdio_write(tp, 0x15, 0x03e6);
-    mdio_write(tp, 0x19, 0xc428);
-    mdio_write(tp, 0x15, 0x03e7);
-    mdio_write(tp, 0x19, 0x0008);
-    mdio_write(tp, 0x15, 0x03e8);
-    mdio_write(tp, 0x19, 0x9af2);
-    mdio_write(tp, 0x15, 0x03e9);
-    mdio_write(tp, 0x19, 0x7c12);
-    mdio_write(tp, 0x15, 0x03ea);
-    mdio_write(tp, 0x19, 0x4c52);
-    mdio_write(tp, 0x15, 0x03eb);
-    mdio_write(tp, 0x19, 0x4470);
-    mdio_write(tp, 0x15, 0x03ec);
-    mdio_write(tp, 0x19, 0x7c12);
-    mdio_write(tp, 0x15, 0x03ed);
-    mdio_write(tp, 0x19, 0x4c40);
-    mdio_write(tp, 0x15, 0x03ee);
-    mdio_write(tp, 0x19, 0x33da);
-    mdio_write(tp, 0x15, 0x03ef);
-    mdio_write(tp, 0x19, 0x3312);
-    mdio_write(tp, 0x16, 0x0306);
-    mdio_write(tp, 0x16, 0x0300);
-    mdio_write(tp, 0x1f, 0x0000);
-    mdio_write(tp, 0x17, 0x2179);
-    mdio_write(tp, 0x1f, 0x0007);
-    mdio_write(tp, 0x1e, 0x0040);
-    mdio_write(tp, 0x18, 0x0645);
-    mdio_write(tp, 0x19, 0xe200);
-    mdio_write(tp, 0x18, 0x0655);
-    mdio_write(tp, 0x19, 0x9000);
-    mdio_write(tp, 0x18, 0x0d05);
-    mdio_write(tp, 0x19, 0xbe00);
-    mdio_write(tp, 0x18, 0x0d15);
-    mdio_write(tp, 0x19, 0xd300);
-    mdio_write(tp, 0x18, 0x0d25);
-    mdio_write(tp, 0x19, 0xfe00);
-    mdio_write(tp, 0x18, 0x0d35);
-    mdio_write(tp, 0x19, 0x4000);
-    mdio_write(tp, 0x18, 0x0d45);
-    mdio_write(tp, 0x19, 0x7f00);
-    mdio_write(tp, 0x18, 0x0d55);
-    mdio_write(tp, 0x19, 0x1000);
-    mdio_write(tp, 0x18, 0x0d65);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x0d75);
-    mdio_write(tp, 0x19, 0x8200);
-    mdio_write(tp, 0x18, 0x0d85);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x0d95);
-    mdio_write(tp, 0x19, 0x7000);
-    mdio_write(tp, 0x18, 0x0da5);
-    mdio_write(tp, 0x19, 0x0f00);
-    mdio_write(tp, 0x18, 0x0db5);
-    mdio_write(tp, 0x19, 0x0100);
-    mdio_write(tp, 0x18, 0x0dc5);
-    mdio_write(tp, 0x19, 0x9b00);
-    mdio_write(tp, 0x18, 0x0dd5);
-    mdio_write(tp, 0x19, 0x7f00);
-    mdio_write(tp, 0x18, 0x0de5);
-    mdio_write(tp, 0x19, 0xe000);
-    mdio_write(tp, 0x18, 0x0df5);
-    mdio_write(tp, 0x19, 0xef00);
-    mdio_write(tp, 0x18, 0x16d5);
-    mdio_write(tp, 0x19, 0xe200);
-    mdio_write(tp, 0x18, 0x16e5);
-    mdio_write(tp, 0x19, 0xab00);
-    mdio_write(tp, 0x18, 0x2904);
-    mdio_write(tp, 0x19, 0x4000);
-    mdio_write(tp, 0x18, 0x2914);
-    mdio_write(tp, 0x19, 0x7f00);
-    mdio_write(tp, 0x18, 0x2924);
-    mdio_write(tp, 0x19, 0x0100);
-    mdio_write(tp, 0x18, 0x2934);
-    mdio_write(tp, 0x19, 0x2000);
-    mdio_write(tp, 0x18, 0x2944);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x2954);
-    mdio_write(tp, 0x19, 0x4600);
-    mdio_write(tp, 0x18, 0x2964);
-    mdio_write(tp, 0x19, 0xfc00);
-    mdio_write(tp, 0x18, 0x2974);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x2984);
-    mdio_write(tp, 0x19, 0x5000);
-    mdio_write(tp, 0x18, 0x2994);
-    mdio_write(tp, 0x19, 0x9d00);
-    mdio_write(tp, 0x18, 0x29a4);
-    mdio_write(tp, 0x19, 0xff00);
-    mdio_write(tp, 0x18, 0x29b4);
-    mdio_write(tp, 0x19, 0x4000);
-    mdio_write(tp, 0x18, 0x29c4);
-    mdio_write(tp, 0x19, 0x7f00);
-    mdio_write(tp, 0x18, 0x29d4);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x29e4);
-    mdio_write(tp, 0x19, 0x2000);
-    mdio_write(tp, 0x18, 0x29f4);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x2a04);
-    mdio_write(tp, 0x19, 0xe600);
-    mdio_write(tp, 0x18, 0x2a14);
-    mdio_write(tp, 0x19, 0xff00);
-    mdio_write(tp, 0x18, 0x2a24);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x2a34);
-    mdio_write(tp, 0x19, 0x5000);
-    mdio_write(tp, 0x18, 0x2a44);
-    mdio_write(tp, 0x19, 0x8500);
-    mdio_write(tp, 0x18, 0x2a54);
-    mdio_write(tp, 0x19, 0x7f00);
-    mdio_write(tp, 0x18, 0x2a64);
-    mdio_write(tp, 0x19, 0xac00);
-    mdio_write(tp, 0x18, 0x2a74);
-    mdio_write(tp, 0x19, 0x0800);
-    mdio_write(tp, 0x18, 0x2a84);
-    mdio_write(tp, 0x19, 0xfc00);
-    mdio_write(tp, 0x18, 0x2a94);
-    mdio_write(tp, 0x19, 0xe000);
-    mdio_write(tp, 0x18, 0x2aa4);
-    mdio_write(tp, 0x19, 0x7400);
-    mdio_write(tp, 0x18, 0x2ab4);
-    mdio_write(tp, 0x19, 0x4000);
-    mdio_write(tp, 0x18, 0x2ac4);
-    mdio_write(tp, 0x19, 0x7f00);
-    mdio_write(tp, 0x18, 0x2ad4);
-    mdio_write(tp, 0x19, 0x0100);
-    mdio_write(tp, 0x18, 0x2ae4);
-    mdio_write(tp, 0x19, 0xff00);
-    mdio_write(tp, 0x18, 0x2af4);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x2b04);
-    mdio_write(tp, 0x19, 0x4400);
-    mdio_write(tp, 0x18, 0x2b14);
-    mdio_write(tp, 0x19, 0xfc00);
-    mdio_write(tp, 0x18, 0x2b24);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x2b34);
-    mdio_write(tp, 0x19, 0x4000);
-    mdio_write(tp, 0x18, 0x2b44);
-    mdio_write(tp, 0x19, 0x9d00);
-    mdio_write(tp, 0x18, 0x2b54);
-    mdio_write(tp, 0x19, 0xff00);
-    mdio_write(tp, 0x18, 0x2b64);
-    mdio_write(tp, 0x19, 0x4000);
-    mdio_write(tp, 0x18, 0x2b74);
-    mdio_write(tp, 0x19, 0x7f00);
-    mdio_write(tp, 0x18, 0x2b84);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x2b94);
-    mdio_write(tp, 0x19, 0xff00);
-    mdio_write(tp, 0x18, 0x2ba4);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x2bb4);
-    mdio_write(tp, 0x19, 0xfc00);
-    mdio_write(tp, 0x18, 0x2bc4);
-    mdio_write(tp, 0x19, 0xff00);
-    mdio_write(tp, 0x18, 0x2bd4);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x2be4);
-    mdio_write(tp, 0x19, 0x4000);
-    mdio_write(tp, 0x18, 0x2bf4);
-    mdio_write(tp, 0x19, 0x8900);
-    mdio_write(tp, 0x18, 0x2c04);
-    mdio_write(tp, 0x19, 0x8300);
-    mdio_write(tp, 0x18, 0x2c14);
-    mdio_write(tp, 0x19, 0xe000);
-    mdio_write(tp, 0x18, 0x2c24);
-    mdio_write(tp, 0x19, 0x0000);
-    mdio_write(tp, 0x18, 0x2c34);
-    mdio_write(tp, 0x19, 0xac00);
-    mdio_write(tp, 0x18, 0x2c44);
-    mdio_write(tp, 0x19, 0x0800);
-    mdio_write(tp, 0x18, 0x2c54);
-    mdio_write(tp, 0x19, 0xfa00);
-    mdio_write(tp, 0x18, 0x2c64);
-    mdio_write(tp, 0x19, 0xe100);
-    mdio_write(tp, 0x18, 0x2c74);
-    mdio_write(tp, 0x19, 0x7f00);
-    mdio_write(tp, 0x18, 0x0001);
-    mdio_write(tp, 0x1f, 0x0000);
-    mdio_write(tp, 0x17, 0x2100);
-    mdio_write(tp, 0x1f, 0x0005);
-    mdio_write(tp, 0x05, 0xfff6);
-    mdio_write(tp, 0x06, 0x0080);
-    mdio_write(tp, 0x05, 0x8000);
-    mdio_write(tp, 0x06, 0xd480);
-    mdio_write(tp, 0x06, 0xc1e4);
-    mdio_write(tp, 0x06, 0x8b9a);
-    mdio_write(tp, 0x06, 0xe58b);
-    mdio_write(tp, 0x06, 0x9bee);
-    mdio_write(tp, 0x06, 0x8b83);
-    mdio_write(tp, 0x06, 0x41bf);
-    mdio_write(tp, 0x06, 0x8b88);
-    mdio_write(tp, 0x06, 0xec00);
-    mdio_write(tp, 0x06, 0x19a9);
-    mdio_write(tp, 0x06, 0x8b90);
-    mdio_write(tp, 0x06, 0xf9ee);
-    mdio_write(tp, 0x06, 0xfff6);
-    mdio_write(tp, 0x06, 0x00ee);
-    mdio_write(tp, 0x06, 0xfff7);
-    mdio_write(tp, 0x06, 0xffe0);
-    mdio_write(tp, 0x06, 0xe140);
-    mdio_write(tp, 0x06, 0xe1e1);
-    mdio_write(tp, 0x06, 0x41f7);
-    mdio_write(tp, 0x06, 0x2ff6);
-    mdio_write(tp, 0x06, 0x28e4);
-    mdio_write(tp, 0x06, 0xe140);
-    mdio_write(tp, 0x06, 0xe5e1);
-    mdio_write(tp, 0x06, 0x41f7);
-    mdio_write(tp, 0x06, 0x0002);
-    mdio_write(tp, 0x06, 0x020c);
-    mdio_write(tp, 0x06, 0x0202);
-    mdio_write(tp, 0x06, 0x1d02);
-    mdio_write(tp, 0x06, 0x0230);
-    mdio_write(tp, 0x06, 0x0202);
-    mdio_write(tp, 0x06, 0x4002);
-    mdio_write(tp, 0x06, 0x028b);
-    mdio_write(tp, 0x06, 0x0280);
-    mdio_write(tp, 0x06, 0x6c02);
-    mdio_write(tp, 0x06, 0x8085);
-    mdio_write(tp, 0x06, 0xe08b);
-    mdio_write(tp, 0x06, 0x88e1);
-    mdio_write(tp, 0x06, 0x8b89);
-    mdio_write(tp, 0x06, 0x1e01);
-    mdio_write(tp, 0x06, 0xe18b);
-    mdio_write(tp, 0x06, 0x8a1e);
-    mdio_write(tp, 0x06, 0x01e1);
-    mdio_write(tp, 0x06, 0x8b8b);
-    mdio_write(tp, 0x06, 0x1e01);
-    mdio_write(tp, 0x06, 0xe18b);
-    mdio_write(tp, 0x06, 0x8c1e);
-    mdio_write(tp, 0x06, 0x01e1);
-    mdio_write(tp, 0x06, 0x8b8d);
-    mdio_write(tp, 0x06, 0x1e01);
-    mdio_write(tp, 0x06, 0xe18b);
-    mdio_write(tp, 0x06, 0x8e1e);
-    mdio_write(tp, 0x06, 0x01a0);
-    mdio_write(tp, 0x06, 0x00c7);
-    mdio_write(tp, 0x06, 0xaec3);
-    mdio_write(tp, 0x06, 0xf8e0);
-    mdio_write(tp, 0x06, 0x8b8d);
-    mdio_write(tp, 0x06, 0xad20);
-    mdio_write(tp, 0x06, 0x10ee);
-    mdio_write(tp, 0x06, 0x8b8d);
-    mdio_write(tp, 0x06, 0x0002);
-    mdio_write(tp, 0x06, 0x1310);
-    mdio_write(tp, 0x06, 0x0280);
-    mdio_write(tp, 0x06, 0xc602);
-    mdio_write(tp, 0x06, 0x1f0c);
-    mdio_write(tp, 0x06, 0x0227);
-    mdio_write(tp, 0x06, 0x49fc);
-    mdio_write(tp, 0x06, 0x04f8);
-    mdio_write(tp, 0x06, 0xe08b);
-    mdio_write(tp, 0x06, 0x8ead);
-    mdio_write(tp, 0x06, 0x200b);
-    mdio_write(tp, 0x06, 0xf620);
-    mdio_write(tp, 0x06, 0xe48b);
-    mdio_write(tp, 0x06, 0x8e02);
-    mdio_write(tp, 0x06, 0x852d);
-    mdio_write(tp, 0x06, 0x021b);
-    mdio_write(tp, 0x06, 0x67ad);
-    mdio_write(tp, 0x06, 0x2211);
-    mdio_write(tp, 0x06, 0xf622);
-    mdio_write(tp, 0x06, 0xe48b);
-    mdio_write(tp, 0x06, 0x8e02);
-    mdio_write(tp, 0x06, 0x2ba5);
-    mdio_write(tp, 0x06, 0x022a);
-    mdio_write(tp, 0x06, 0x2402);
-    mdio_write(tp, 0x06, 0x82e5);
-    mdio_write(tp, 0x06, 0x022a);
-    mdio_write(tp, 0x06, 0xf0ad);
-    mdio_write(tp, 0x06, 0x2511);
-    mdio_write(tp, 0x06, 0xf625);
-    mdio_write(tp, 0x06, 0xe48b);
-    mdio_write(tp, 0x06, 0x8e02);
-    mdio_write(tp, 0x06, 0x8445);
-    mdio_write(tp, 0x06, 0x0204);
-    mdio_write(tp, 0x06, 0x0302);
-    mdio_write(tp, 0x06, 0x19cc);
-    mdio_write(tp, 0x06, 0x022b);
-    mdio_write(tp, 0x06, 0x5bfc);
-    mdio_write(tp, 0x06, 0x04ee);
-    mdio_write(tp, 0x06, 0x8b8d);
-    mdio_write(tp, 0x06, 0x0105);
-    mdio_write(tp, 0x06, 0xf8f9);
-    mdio_write(tp, 0x06, 0xfae0);
-    mdio_write(tp, 0x06, 0x8b81);
-    mdio_write(tp, 0x06, 0xac26);
-    mdio_write(tp, 0x06, 0x08e0);
-    mdio_write(tp, 0x06, 0x8b81);
-    mdio_write(tp, 0x06, 0xac21);
-    mdio_write(tp, 0x06, 0x02ae);
-    mdio_write(tp, 0x06, 0x6bee);
-    mdio_write(tp, 0x06, 0xe0ea);
-    mdio_write(tp, 0x06, 0x00ee);
-    mdio_write(tp, 0x06, 0xe0eb);
-    mdio_write(tp, 0x06, 0x00e2);
-    mdio_write(tp, 0x06, 0xe07c);
-    mdio_write(tp, 0x06, 0xe3e0);
-    mdio_write(tp, 0x06, 0x7da5);
-    mdio_write(tp, 0x06, 0x1111);
-    mdio_write(tp, 0x06, 0x15d2);
-    mdio_write(tp, 0x06, 0x60d6);
-    mdio_write(tp, 0x06, 0x6666);
-    mdio_write(tp, 0x06, 0x0207);
-    mdio_write(tp, 0x06, 0x6cd2);
-    mdio_write(tp, 0x06, 0xa0d6);
-    mdio_write(tp, 0x06, 0xaaaa);
-    mdio_write(tp, 0x06, 0x0207);
-    mdio_write(tp, 0x06, 0x6c02);
-    mdio_write(tp, 0x06, 0x201d);
-    mdio_write(tp, 0x06, 0xae44);
-    mdio_write(tp, 0x06, 0xa566);
-    mdio_write(tp, 0x06, 0x6602);
-    mdio_write(tp, 0x06, 0xae38);
-    mdio_write(tp, 0x06, 0xa5aa);
-    mdio_write(tp, 0x06, 0xaa02);
-    mdio_write(tp, 0x06, 0xae32);
-    mdio_write(tp, 0x06, 0xeee0);
-    mdio_write(tp, 0x06, 0xea04);
-    mdio_write(tp, 0x06, 0xeee0);
-    mdio_write(tp, 0x06, 0xeb06);
-    mdio_write(tp, 0x06, 0xe2e0);
-    mdio_write(tp, 0x06, 0x7ce3);
-    mdio_write(tp, 0x06, 0xe07d);
-    mdio_write(tp, 0x06, 0xe0e0);
-    mdio_write(tp, 0x06, 0x38e1);
-    mdio_write(tp, 0x06, 0xe039);
-    mdio_write(tp, 0x06, 0xad2e);
-    mdio_write(tp, 0x06, 0x21ad);
-    mdio_write(tp, 0x06, 0x3f13);
-    mdio_write(tp, 0x06, 0xe0e4);
-    mdio_write(tp, 0x06, 0x14e1);
-    mdio_write(tp, 0x06, 0xe415);
-    mdio_write(tp, 0x06, 0x6880);
-    mdio_write(tp, 0x06, 0xe4e4);
-    mdio_write(tp, 0x06, 0x14e5);
-    mdio_write(tp, 0x06, 0xe415);
-    mdio_write(tp, 0x06, 0x0220);
-    mdio_write(tp, 0x06, 0x1dae);
-    mdio_write(tp, 0x06, 0x0bac);
-    mdio_write(tp, 0x06, 0x3e02);
-    mdio_write(tp, 0x06, 0xae06);
-    mdio_write(tp, 0x06, 0x0281);
-    mdio_write(tp, 0x06, 0x4602);
-    mdio_write(tp, 0x06, 0x2057);
-    mdio_write(tp, 0x06, 0xfefd);
-    mdio_write(tp, 0x06, 0xfc04);
-    mdio_write(tp, 0x06, 0xf8e0);
-    mdio_write(tp, 0x06, 0x8b81);
-    mdio_write(tp, 0x06, 0xad26);
-    mdio_write(tp, 0x06, 0x0302);
-    mdio_write(tp, 0x06, 0x20a7);
-    mdio_write(tp, 0x06, 0xe08b);
-    mdio_write(tp, 0x06, 0x81ad);
-    mdio_write(tp, 0x06, 0x2109);
-    mdio_write(tp, 0x06, 0xe08b);
-    mdio_write(tp, 0x06, 0x2eac);
-    mdio_write(tp, 0x06, 0x2003);
-    mdio_write(tp, 0x06, 0x0281);
-    mdio_write(tp, 0x06, 0x61fc);
-    mdio_write(tp, 0x06, 0x04f8);
-    mdio_write(tp, 0x06, 0xe08b);
-    mdio_write(tp, 0x06, 0x81ac);
-    mdio_write(tp, 0x06, 0x2505);
-    mdio_write(tp, 0x06, 0x0222);
-    mdio_write(tp, 0x06, 0xaeae);
-    mdio_write(tp, 0x06, 0x0302);
-    mdio_write(tp, 0x06, 0x8172);
-    mdio_write(tp, 0x06, 0xfc04);
-    mdio_write(tp, 0x06, 0xf8f9);
-    mdio_write(tp, 0x06, 0xfaef);
-    mdio_write(tp, 0x06, 0x69fa);
-    mdio_write(tp, 0x06, 0xe086);
-    mdio_write(tp, 0x06, 0x20a0);
-    mdio_write(tp, 0x06, 0x8016);
-    mdio_write(tp, 0x06, 0xe086);
-    mdio_write(tp, 0x06, 0x21e1);
-    mdio_write(tp, 0x06, 0x8b33);
-    mdio_write(tp, 0x06, 0x1b10);
-    mdio_write(tp, 0x06, 0x9e06);
-    mdio_write(tp, 0x06, 0x0223);
-    mdio_write(tp, 0x06, 0x91af);
-    mdio_write(tp, 0x06, 0x8252);
-    mdio_write(tp, 0x06, 0xee86);
-    mdio_write(tp, 0x06, 0x2081);
-    mdio_write(tp, 0x06, 0xaee4);
-    mdio_write(tp, 0x06, 0xa081);
-    mdio_write(tp, 0x06, 0x1402);
-    mdio_write(tp, 0x06, 0x2399);
-    mdio_write(tp, 0x06, 0xbf25);
-    mdio_write(tp, 0x06, 0xcc02);
-    mdio_write(tp, 0x06, 0x2d21);
-    mdio_write(tp, 0x06, 0xee86);
-    mdio_write(tp, 0x06, 0x2100);
-    mdio_write(tp, 0x06, 0xee86);
-    mdio_write(tp, 0x06, 0x2082);
-    mdio_write(tp, 0x06, 0xaf82);
-    mdio_write(tp, 0x06, 0x52a0);
-    mdio_write(tp, 0x06, 0x8232);
-    mdio_write(tp, 0x06, 0xe086);
-    mdio_write(tp, 0x06, 0x21e1);
-    mdio_write(tp, 0x06, 0x8b32);
-    mdio_write(tp, 0x06, 0x1b10);
-    mdio_write(tp, 0x06, 0x9e06);
-    mdio_write(tp, 0x06, 0x0223);
-    mdio_write(tp, 0x06, 0x91af);
-    mdio_write(tp, 0x06, 0x8252);
-    mdio_write(tp, 0x06, 0xee86);
-    mdio_write(tp, 0x06, 0x2100);
-    mdio_write(tp, 0x06, 0xd000);
-    mdio_write(tp, 0x06, 0x0282);
-    mdio_write(tp, 0x06, 0x5910);
-    mdio_write(tp, 0x06, 0xa004);
-    mdio_write(tp, 0x06, 0xf9e0);
-    mdio_write(tp, 0x06, 0x861f);
-    mdio_write(tp, 0x06, 0xa000);
-    mdio_write(tp, 0x06, 0x07ee);
-    mdio_write(tp, 0x06, 0x8620);
-    mdio_write(tp, 0x06, 0x83af);
-    mdio_write(tp, 0x06, 0x8178);
-    mdio_write(tp, 0x06, 0x0224);
-    mdio_write(tp, 0x06, 0x0102);
-    mdio_write(tp, 0x06, 0x2399);
-    mdio_write(tp, 0x06, 0xae72);
-    mdio_write(tp, 0x06, 0xa083);
-    mdio_write(tp, 0x06, 0x4b1f);
-    mdio_write(tp, 0x06, 0x55d0);
-    mdio_write(tp, 0x06, 0x04bf);
-    mdio_write(tp, 0x06, 0x8615);
-    mdio_write(tp, 0x06, 0x1a90);
-    mdio_write(tp, 0x06, 0x0c54);
-    mdio_write(tp, 0x06, 0xd91e);
-    mdio_write(tp, 0x06, 0x31b0);
-    mdio_write(tp, 0x06, 0xf4e0);
-    mdio_write(tp, 0x06, 0xe022);
-    mdio_write(tp, 0x06, 0xe1e0);
-    mdio_write(tp, 0x06, 0x23ad);
-    mdio_write(tp, 0x06, 0x2e0c);
-    mdio_write(tp, 0x06, 0xef02);
-    mdio_write(tp, 0x06, 0xef12);
-    mdio_write(tp, 0x06, 0x0e44);
-    mdio_write(tp, 0x06, 0xef23);
-    mdio_write(tp, 0x06, 0x0e54);
-    mdio_write(tp, 0x06, 0xef21);
-    mdio_write(tp, 0x06, 0xe6e4);
-    mdio_write(tp, 0x06, 0x2ae7);
-    mdio_write(tp, 0x06, 0xe42b);
-    mdio_write(tp, 0x06, 0xe2e4);
-    mdio_write(tp, 0x06, 0x28e3);
-    mdio_write(tp, 0x06, 0xe429);
-    mdio_write(tp, 0x06, 0x6d20);
-    mdio_write(tp, 0x06, 0x00e6);
-    mdio_write(tp, 0x06, 0xe428);
-    mdio_write(tp, 0x06, 0xe7e4);
-    mdio_write(tp, 0x06, 0x29bf);
-    mdio_write(tp, 0x06, 0x25ca);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0x21ee);
-    mdio_write(tp, 0x06, 0x8620);
-    mdio_write(tp, 0x06, 0x84ee);
-    mdio_write(tp, 0x06, 0x8621);
-    mdio_write(tp, 0x06, 0x00af);
-    mdio_write(tp, 0x06, 0x8178);
-    mdio_write(tp, 0x06, 0xa084);
-    mdio_write(tp, 0x06, 0x19e0);
-    mdio_write(tp, 0x06, 0x8621);
-    mdio_write(tp, 0x06, 0xe18b);
-    mdio_write(tp, 0x06, 0x341b);
-    mdio_write(tp, 0x06, 0x109e);
-    mdio_write(tp, 0x06, 0x0602);
-    mdio_write(tp, 0x06, 0x2391);
-    mdio_write(tp, 0x06, 0xaf82);
-    mdio_write(tp, 0x06, 0x5202);
-    mdio_write(tp, 0x06, 0x241f);
-    mdio_write(tp, 0x06, 0xee86);
-    mdio_write(tp, 0x06, 0x2085);
-    mdio_write(tp, 0x06, 0xae08);
-    mdio_write(tp, 0x06, 0xa085);
-    mdio_write(tp, 0x06, 0x02ae);
-    mdio_write(tp, 0x06, 0x0302);
-    mdio_write(tp, 0x06, 0x2442);
-    mdio_write(tp, 0x06, 0xfeef);
-    mdio_write(tp, 0x06, 0x96fe);
-    mdio_write(tp, 0x06, 0xfdfc);
-    mdio_write(tp, 0x06, 0x04f8);
-    mdio_write(tp, 0x06, 0xf9fa);
-    mdio_write(tp, 0x06, 0xef69);
-    mdio_write(tp, 0x06, 0xfad1);
-    mdio_write(tp, 0x06, 0x801f);
-    mdio_write(tp, 0x06, 0x66e2);
-    mdio_write(tp, 0x06, 0xe0ea);
-    mdio_write(tp, 0x06, 0xe3e0);
-    mdio_write(tp, 0x06, 0xeb5a);
-    mdio_write(tp, 0x06, 0xf81e);
-    mdio_write(tp, 0x06, 0x20e6);
-    mdio_write(tp, 0x06, 0xe0ea);
-    mdio_write(tp, 0x06, 0xe5e0);
-    mdio_write(tp, 0x06, 0xebd3);
-    mdio_write(tp, 0x06, 0x05b3);
-    mdio_write(tp, 0x06, 0xfee2);
-    mdio_write(tp, 0x06, 0xe07c);
-    mdio_write(tp, 0x06, 0xe3e0);
-    mdio_write(tp, 0x06, 0x7dad);
-    mdio_write(tp, 0x06, 0x3703);
-    mdio_write(tp, 0x06, 0x7dff);
-    mdio_write(tp, 0x06, 0xff0d);
-    mdio_write(tp, 0x06, 0x581c);
-    mdio_write(tp, 0x06, 0x55f8);
-    mdio_write(tp, 0x06, 0xef46);
-    mdio_write(tp, 0x06, 0x0282);
-    mdio_write(tp, 0x06, 0xc7ef);
-    mdio_write(tp, 0x06, 0x65ef);
-    mdio_write(tp, 0x06, 0x54fc);
-    mdio_write(tp, 0x06, 0xac30);
-    mdio_write(tp, 0x06, 0x2b11);
-    mdio_write(tp, 0x06, 0xa188);
-    mdio_write(tp, 0x06, 0xcabf);
-    mdio_write(tp, 0x06, 0x860e);
-    mdio_write(tp, 0x06, 0xef10);
-    mdio_write(tp, 0x06, 0x0c11);
-    mdio_write(tp, 0x06, 0x1a91);
-    mdio_write(tp, 0x06, 0xda19);
-    mdio_write(tp, 0x06, 0xdbf8);
-    mdio_write(tp, 0x06, 0xef46);
-    mdio_write(tp, 0x06, 0x021e);
-    mdio_write(tp, 0x06, 0x17ef);
-    mdio_write(tp, 0x06, 0x54fc);
-    mdio_write(tp, 0x06, 0xad30);
-    mdio_write(tp, 0x06, 0x0fef);
-    mdio_write(tp, 0x06, 0x5689);
-    mdio_write(tp, 0x06, 0xde19);
-    mdio_write(tp, 0x06, 0xdfe2);
-    mdio_write(tp, 0x06, 0x861f);
-    mdio_write(tp, 0x06, 0xbf86);
-    mdio_write(tp, 0x06, 0x161a);
-    mdio_write(tp, 0x06, 0x90de);
-    mdio_write(tp, 0x06, 0xfeef);
-    mdio_write(tp, 0x06, 0x96fe);
-    mdio_write(tp, 0x06, 0xfdfc);
-    mdio_write(tp, 0x06, 0x04ac);
-    mdio_write(tp, 0x06, 0x2707);
-    mdio_write(tp, 0x06, 0xac37);
-    mdio_write(tp, 0x06, 0x071a);
-    mdio_write(tp, 0x06, 0x54ae);
-    mdio_write(tp, 0x06, 0x11ac);
-    mdio_write(tp, 0x06, 0x3707);
-    mdio_write(tp, 0x06, 0xae00);
-    mdio_write(tp, 0x06, 0x1a54);
-    mdio_write(tp, 0x06, 0xac37);
-    mdio_write(tp, 0x06, 0x07d0);
-    mdio_write(tp, 0x06, 0x01d5);
-    mdio_write(tp, 0x06, 0xffff);
-    mdio_write(tp, 0x06, 0xae02);
-    mdio_write(tp, 0x06, 0xd000);
-    mdio_write(tp, 0x06, 0x04f8);
-    mdio_write(tp, 0x06, 0xe08b);
-    mdio_write(tp, 0x06, 0x83ad);
-    mdio_write(tp, 0x06, 0x2444);
-    mdio_write(tp, 0x06, 0xe0e0);
-    mdio_write(tp, 0x06, 0x22e1);
-    mdio_write(tp, 0x06, 0xe023);
-    mdio_write(tp, 0x06, 0xad22);
-    mdio_write(tp, 0x06, 0x3be0);
-    mdio_write(tp, 0x06, 0x8abe);
-    mdio_write(tp, 0x06, 0xa000);
-    mdio_write(tp, 0x06, 0x0502);
-    mdio_write(tp, 0x06, 0x28de);
-    mdio_write(tp, 0x06, 0xae42);
-    mdio_write(tp, 0x06, 0xa001);
-    mdio_write(tp, 0x06, 0x0502);
-    mdio_write(tp, 0x06, 0x28f1);
-    mdio_write(tp, 0x06, 0xae3a);
-    mdio_write(tp, 0x06, 0xa002);
-    mdio_write(tp, 0x06, 0x0502);
-    mdio_write(tp, 0x06, 0x8344);
-    mdio_write(tp, 0x06, 0xae32);
-    mdio_write(tp, 0x06, 0xa003);
-    mdio_write(tp, 0x06, 0x0502);
-    mdio_write(tp, 0x06, 0x299a);
-    mdio_write(tp, 0x06, 0xae2a);
-    mdio_write(tp, 0x06, 0xa004);
-    mdio_write(tp, 0x06, 0x0502);
-    mdio_write(tp, 0x06, 0x29ae);
-    mdio_write(tp, 0x06, 0xae22);
-    mdio_write(tp, 0x06, 0xa005);
-    mdio_write(tp, 0x06, 0x0502);
-    mdio_write(tp, 0x06, 0x29d7);
-    mdio_write(tp, 0x06, 0xae1a);
-    mdio_write(tp, 0x06, 0xa006);
-    mdio_write(tp, 0x06, 0x0502);
-    mdio_write(tp, 0x06, 0x29fe);
-    mdio_write(tp, 0x06, 0xae12);
-    mdio_write(tp, 0x06, 0xee8a);
-    mdio_write(tp, 0x06, 0xc000);
-    mdio_write(tp, 0x06, 0xee8a);
-    mdio_write(tp, 0x06, 0xc100);
-    mdio_write(tp, 0x06, 0xee8a);
-    mdio_write(tp, 0x06, 0xc600);
-    mdio_write(tp, 0x06, 0xee8a);
-    mdio_write(tp, 0x06, 0xbe00);
-    mdio_write(tp, 0x06, 0xae00);
-    mdio_write(tp, 0x06, 0xfc04);
-    mdio_write(tp, 0x06, 0xf802);
-    mdio_write(tp, 0x06, 0x2a67);
-    mdio_write(tp, 0x06, 0xe0e0);
-    mdio_write(tp, 0x06, 0x22e1);
-    mdio_write(tp, 0x06, 0xe023);
-    mdio_write(tp, 0x06, 0x0d06);
-    mdio_write(tp, 0x06, 0x5803);
-    mdio_write(tp, 0x06, 0xa002);
-    mdio_write(tp, 0x06, 0x02ae);
-    mdio_write(tp, 0x06, 0x2da0);
-    mdio_write(tp, 0x06, 0x0102);
-    mdio_write(tp, 0x06, 0xae2d);
-    mdio_write(tp, 0x06, 0xa000);
-    mdio_write(tp, 0x06, 0x4de0);
-    mdio_write(tp, 0x06, 0xe200);
-    mdio_write(tp, 0x06, 0xe1e2);
-    mdio_write(tp, 0x06, 0x01ad);
-    mdio_write(tp, 0x06, 0x2444);
-    mdio_write(tp, 0x06, 0xe08a);
-    mdio_write(tp, 0x06, 0xc2e4);
-    mdio_write(tp, 0x06, 0x8ac4);
-    mdio_write(tp, 0x06, 0xe08a);
-    mdio_write(tp, 0x06, 0xc3e4);
-    mdio_write(tp, 0x06, 0x8ac5);
-    mdio_write(tp, 0x06, 0xee8a);
-    mdio_write(tp, 0x06, 0xbe03);
-    mdio_write(tp, 0x06, 0xe08b);
-    mdio_write(tp, 0x06, 0x83ad);
-    mdio_write(tp, 0x06, 0x253a);
-    mdio_write(tp, 0x06, 0xee8a);
-    mdio_write(tp, 0x06, 0xbe05);
-    mdio_write(tp, 0x06, 0xae34);
-    mdio_write(tp, 0x06, 0xe08a);
-    mdio_write(tp, 0x06, 0xceae);
-    mdio_write(tp, 0x06, 0x03e0);
-    mdio_write(tp, 0x06, 0x8acf);
-    mdio_write(tp, 0x06, 0xe18a);
-    mdio_write(tp, 0x06, 0xc249);
-    mdio_write(tp, 0x06, 0x05e5);
-    mdio_write(tp, 0x06, 0x8ac4);
-    mdio_write(tp, 0x06, 0xe18a);
-    mdio_write(tp, 0x06, 0xc349);
-    mdio_write(tp, 0x06, 0x05e5);
-    mdio_write(tp, 0x06, 0x8ac5);
-    mdio_write(tp, 0x06, 0xee8a);
-    mdio_write(tp, 0x06, 0xbe05);
-    mdio_write(tp, 0x06, 0x022a);
-    mdio_write(tp, 0x06, 0xb6ac);
-    mdio_write(tp, 0x06, 0x2012);
-    mdio_write(tp, 0x06, 0x0283);
-    mdio_write(tp, 0x06, 0xbaac);
-    mdio_write(tp, 0x06, 0x200c);
-    mdio_write(tp, 0x06, 0xee8a);
-    mdio_write(tp, 0x06, 0xc100);
-    mdio_write(tp, 0x06, 0xee8a);
-    mdio_write(tp, 0x06, 0xc600);
-    mdio_write(tp, 0x06, 0xee8a);
-    mdio_write(tp, 0x06, 0xbe02);
-    mdio_write(tp, 0x06, 0xfc04);
-    mdio_write(tp, 0x06, 0xd000);
-    mdio_write(tp, 0x06, 0x0283);
-    mdio_write(tp, 0x06, 0xcc59);
-    mdio_write(tp, 0x06, 0x0f39);
-    mdio_write(tp, 0x06, 0x02aa);
-    mdio_write(tp, 0x06, 0x04d0);
-    mdio_write(tp, 0x06, 0x01ae);
-    mdio_write(tp, 0x06, 0x02d0);
-    mdio_write(tp, 0x06, 0x0004);
-    mdio_write(tp, 0x06, 0xf9fa);
-    mdio_write(tp, 0x06, 0xe2e2);
-    mdio_write(tp, 0x06, 0xd2e3);
-    mdio_write(tp, 0x06, 0xe2d3);
-    mdio_write(tp, 0x06, 0xf95a);
-    mdio_write(tp, 0x06, 0xf7e6);
-    mdio_write(tp, 0x06, 0xe2d2);
-    mdio_write(tp, 0x06, 0xe7e2);
-    mdio_write(tp, 0x06, 0xd3e2);
-    mdio_write(tp, 0x06, 0xe02c);
-    mdio_write(tp, 0x06, 0xe3e0);
-    mdio_write(tp, 0x06, 0x2df9);
-    mdio_write(tp, 0x06, 0x5be0);
-    mdio_write(tp, 0x06, 0x1e30);
-    mdio_write(tp, 0x06, 0xe6e0);
-    mdio_write(tp, 0x06, 0x2ce7);
-    mdio_write(tp, 0x06, 0xe02d);
-    mdio_write(tp, 0x06, 0xe2e2);
-    mdio_write(tp, 0x06, 0xcce3);
-    mdio_write(tp, 0x06, 0xe2cd);
-    mdio_write(tp, 0x06, 0xf95a);
-    mdio_write(tp, 0x06, 0x0f6a);
-    mdio_write(tp, 0x06, 0x50e6);
-    mdio_write(tp, 0x06, 0xe2cc);
-    mdio_write(tp, 0x06, 0xe7e2);
-    mdio_write(tp, 0x06, 0xcde0);
-    mdio_write(tp, 0x06, 0xe03c);
-    mdio_write(tp, 0x06, 0xe1e0);
-    mdio_write(tp, 0x06, 0x3def);
-    mdio_write(tp, 0x06, 0x64fd);
-    mdio_write(tp, 0x06, 0xe0e2);
-    mdio_write(tp, 0x06, 0xcce1);
-    mdio_write(tp, 0x06, 0xe2cd);
-    mdio_write(tp, 0x06, 0x580f);
-    mdio_write(tp, 0x06, 0x5af0);
-    mdio_write(tp, 0x06, 0x1e02);
-    mdio_write(tp, 0x06, 0xe4e2);
-    mdio_write(tp, 0x06, 0xcce5);
-    mdio_write(tp, 0x06, 0xe2cd);
-    mdio_write(tp, 0x06, 0xfde0);
-    mdio_write(tp, 0x06, 0xe02c);
-    mdio_write(tp, 0x06, 0xe1e0);
-    mdio_write(tp, 0x06, 0x2d59);
-    mdio_write(tp, 0x06, 0xe05b);
-    mdio_write(tp, 0x06, 0x1f1e);
-    mdio_write(tp, 0x06, 0x13e4);
-    mdio_write(tp, 0x06, 0xe02c);
-    mdio_write(tp, 0x06, 0xe5e0);
-    mdio_write(tp, 0x06, 0x2dfd);
-    mdio_write(tp, 0x06, 0xe0e2);
-    mdio_write(tp, 0x06, 0xd2e1);
-    mdio_write(tp, 0x06, 0xe2d3);
-    mdio_write(tp, 0x06, 0x58f7);
-    mdio_write(tp, 0x06, 0x5a08);
-    mdio_write(tp, 0x06, 0x1e02);
-    mdio_write(tp, 0x06, 0xe4e2);
-    mdio_write(tp, 0x06, 0xd2e5);
-    mdio_write(tp, 0x06, 0xe2d3);
-    mdio_write(tp, 0x06, 0xef46);
-    mdio_write(tp, 0x06, 0xfefd);
-    mdio_write(tp, 0x06, 0x04f8);
-    mdio_write(tp, 0x06, 0xf9fa);
-    mdio_write(tp, 0x06, 0xef69);
-    mdio_write(tp, 0x06, 0xe0e0);
-    mdio_write(tp, 0x06, 0x22e1);
-    mdio_write(tp, 0x06, 0xe023);
-    mdio_write(tp, 0x06, 0x58c4);
-    mdio_write(tp, 0x06, 0xe18b);
-    mdio_write(tp, 0x06, 0x6e1f);
-    mdio_write(tp, 0x06, 0x109e);
-    mdio_write(tp, 0x06, 0x58e4);
-    mdio_write(tp, 0x06, 0x8b6e);
-    mdio_write(tp, 0x06, 0xad22);
-    mdio_write(tp, 0x06, 0x22ac);
-    mdio_write(tp, 0x06, 0x2755);
-    mdio_write(tp, 0x06, 0xac26);
-    mdio_write(tp, 0x06, 0x02ae);
-    mdio_write(tp, 0x06, 0x1ad1);
-    mdio_write(tp, 0x06, 0x06bf);
-    mdio_write(tp, 0x06, 0x3bba);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1d1);
-    mdio_write(tp, 0x06, 0x07bf);
-    mdio_write(tp, 0x06, 0x3bbd);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1d1);
-    mdio_write(tp, 0x06, 0x07bf);
-    mdio_write(tp, 0x06, 0x3bc0);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1ae);
-    mdio_write(tp, 0x06, 0x30d1);
-    mdio_write(tp, 0x06, 0x03bf);
-    mdio_write(tp, 0x06, 0x3bc3);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1d1);
-    mdio_write(tp, 0x06, 0x00bf);
-    mdio_write(tp, 0x06, 0x3bc6);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1d1);
-    mdio_write(tp, 0x06, 0x00bf);
-    mdio_write(tp, 0x06, 0x84e9);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1d1);
-    mdio_write(tp, 0x06, 0x0fbf);
-    mdio_write(tp, 0x06, 0x3bba);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1d1);
-    mdio_write(tp, 0x06, 0x01bf);
-    mdio_write(tp, 0x06, 0x3bbd);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1d1);
-    mdio_write(tp, 0x06, 0x01bf);
-    mdio_write(tp, 0x06, 0x3bc0);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1ef);
-    mdio_write(tp, 0x06, 0x96fe);
-    mdio_write(tp, 0x06, 0xfdfc);
-    mdio_write(tp, 0x06, 0x04d1);
-    mdio_write(tp, 0x06, 0x00bf);
-    mdio_write(tp, 0x06, 0x3bc3);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1d0);
-    mdio_write(tp, 0x06, 0x1102);
-    mdio_write(tp, 0x06, 0x2bfb);
-    mdio_write(tp, 0x06, 0x5903);
-    mdio_write(tp, 0x06, 0xef01);
-    mdio_write(tp, 0x06, 0xd100);
-    mdio_write(tp, 0x06, 0xa000);
-    mdio_write(tp, 0x06, 0x02d1);
-    mdio_write(tp, 0x06, 0x01bf);
-    mdio_write(tp, 0x06, 0x3bc6);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1d1);
-    mdio_write(tp, 0x06, 0x11ad);
-    mdio_write(tp, 0x06, 0x2002);
-    mdio_write(tp, 0x06, 0x0c11);
-    mdio_write(tp, 0x06, 0xad21);
-    mdio_write(tp, 0x06, 0x020c);
-    mdio_write(tp, 0x06, 0x12bf);
-    mdio_write(tp, 0x06, 0x84e9);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1ae);
-    mdio_write(tp, 0x06, 0xc870);
-    mdio_write(tp, 0x06, 0xe426);
-    mdio_write(tp, 0x06, 0x0284);
-    mdio_write(tp, 0x06, 0xf005);
-    mdio_write(tp, 0x06, 0xf8fa);
-    mdio_write(tp, 0x06, 0xef69);
-    mdio_write(tp, 0x06, 0xe0e2);
-    mdio_write(tp, 0x06, 0xfee1);
-    mdio_write(tp, 0x06, 0xe2ff);
-    mdio_write(tp, 0x06, 0xad2d);
-    mdio_write(tp, 0x06, 0x1ae0);
-    mdio_write(tp, 0x06, 0xe14e);
-    mdio_write(tp, 0x06, 0xe1e1);
-    mdio_write(tp, 0x06, 0x4fac);
-    mdio_write(tp, 0x06, 0x2d22);
-    mdio_write(tp, 0x06, 0xf603);
-    mdio_write(tp, 0x06, 0x0203);
-    mdio_write(tp, 0x06, 0x3bf7);
-    mdio_write(tp, 0x06, 0x03f7);
-    mdio_write(tp, 0x06, 0x06bf);
-    mdio_write(tp, 0x06, 0x8561);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0x21ae);
-    mdio_write(tp, 0x06, 0x11e0);
-    mdio_write(tp, 0x06, 0xe14e);
-    mdio_write(tp, 0x06, 0xe1e1);
-    mdio_write(tp, 0x06, 0x4fad);
-    mdio_write(tp, 0x06, 0x2d08);
-    mdio_write(tp, 0x06, 0xbf85);
-    mdio_write(tp, 0x06, 0x6c02);
-    mdio_write(tp, 0x06, 0x2d21);
-    mdio_write(tp, 0x06, 0xf606);
-    mdio_write(tp, 0x06, 0xef96);
-    mdio_write(tp, 0x06, 0xfefc);
-    mdio_write(tp, 0x06, 0x04f8);
-    mdio_write(tp, 0x06, 0xfaef);
-    mdio_write(tp, 0x06, 0x69e0);
-    mdio_write(tp, 0x06, 0xe000);
-    mdio_write(tp, 0x06, 0xe1e0);
-    mdio_write(tp, 0x06, 0x01ad);
-    mdio_write(tp, 0x06, 0x271f);
-    mdio_write(tp, 0x06, 0xd101);
-    mdio_write(tp, 0x06, 0xbf85);
-    mdio_write(tp, 0x06, 0x5e02);
-    mdio_write(tp, 0x06, 0x2dc1);
-    mdio_write(tp, 0x06, 0xe0e0);
-    mdio_write(tp, 0x06, 0x20e1);
-    mdio_write(tp, 0x06, 0xe021);
-    mdio_write(tp, 0x06, 0xad20);
-    mdio_write(tp, 0x06, 0x0ed1);
-    mdio_write(tp, 0x06, 0x00bf);
-    mdio_write(tp, 0x06, 0x855e);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0xc1bf);
-    mdio_write(tp, 0x06, 0x3b96);
-    mdio_write(tp, 0x06, 0x022d);
-    mdio_write(tp, 0x06, 0x21ef);
-    mdio_write(tp, 0x06, 0x96fe);
-    mdio_write(tp, 0x06, 0xfc04);
-    mdio_write(tp, 0x06, 0x00e2);
-    mdio_write(tp, 0x06, 0x34a7);
-    mdio_write(tp, 0x06, 0x25e5);
-    mdio_write(tp, 0x06, 0x0a1d);
-    mdio_write(tp, 0x06, 0xe50a);
-    mdio_write(tp, 0x06, 0x2ce5);
-    mdio_write(tp, 0x06, 0x0a6d);
-    mdio_write(tp, 0x06, 0xe50a);
-    mdio_write(tp, 0x06, 0x1de5);
-    mdio_write(tp, 0x06, 0x0a1c);
-    mdio_write(tp, 0x06, 0xe50a);
-    mdio_write(tp, 0x06, 0x2da7);
-    mdio_write(tp, 0x06, 0x5500);
-    mdio_write(tp, 0x05, 0x8b94);
-    mdio_write(tp, 0x06, 0x84ec);
-    gphy_val = mdio_read(tp, 0x01);
-    gphy_val |= BIT_0;
-    mdio_write(tp, 0x01, gphy_val);
-    mdio_write(tp, 0x00, 0x0005);
-    mdio_write(tp, 0x1f, 0x0000);
-    mdio_write(tp, 0x1f, 0x0005);
-    for (i = 0; i < 200; i++) {
-        udelay(100);
-        gphy_val = mdio_read(tp, 0x00);
-        if (gphy_val & BIT_7)
-            break;
-    }
-    mdio_write(tp, 0x1f, 0x0007);
-    mdio_write(tp, 0x1e, 0x0023);
-    mdio_write(tp, 0x17, 0x0116);
-    mdio_write(tp, 0x1f, 0x0007);
-    mdio_write(tp, 0x1e, 0x0028);
-    mdio_write(tp, 0x15, 0x0010);
-    mdio_write(tp, 0x1f, 0x0007);
-    mdio_write(tp, 0x1e, 0x0020);
-    mdio_write(tp, 0x15, 0x0100);
-    mdio_write(tp, 0x1f, 0x0007);
-    mdio_write(tp, 0x1e, 0x0041);
-    mdio_write(tp, 0x15, 0x0802);
-    mdio_write(tp, 0x16, 0x2185);
-    mdio_write(tp, 0x1f, 0x0000);
+#ifdef RTL8101_DEBUG
+    clock_get_uptime(&now);
+    absolutetime_to_nanoseconds(now - start, &now);
+    rtl8101_phy_patch_cost(patch, &writes, &reads, &worst_case_ms);
+    
+    dprintk("PHY patch: %u writes, %u reads, worst case wait %u ms, took %llu us.\n",
+            writes, reads, worst_case_ms, now / 1000);
+#endif
 }
 
+static const struct rtl8101_phy_patch_op rtl8101_phy_mcu_8105e_1[] = {
+    PHY_W(0x1f, 0x0000),
+    PHY_W(0x00, 0x1800),
+    PHY_W(0x1f, 0x0007),
+    PHY_W(0x1e, 0x0023),
+    PHY_W(0x17, 0x0117),
+    PHY_W(0x1f, 0x0007),
+    PHY_W(0x1e, 0x002c),
+    PHY_W(0x1b, 0x5000),
+    PHY_W(0x1f, 0x0000),
+    PHY_W(0x16, 0x4104),
+    PHY_POLL(0x1e, 0x03ff, 0x000c, 20),
+    PHY_W(0x1f, 0x0005),
+    PHY_POLL(0x07, BIT_5, 0, 20),
+    PHY_SKIP_IF_CLEAR(0x07, BIT_5, 10),
+    PHY_W(0x1f, 0x0007),
+    PHY_W(0x1e, 0x00a1),
+    PHY_W(0x17, 0x1000),
+    PHY_W(0x17, 0x0000),
+    PHY_W(0x17, 0x2000),
+    PHY_W(0x1e, 0x002f),
+    PHY_W(0x18, 0x9bfb),
+    PHY_W(0x1f, 0x0005),
+    PHY_W(0x07, 0x0000),
+    PHY_W(0x1f, 0x0000),
+    PHY_W(0x1f, 0x0005),
+    PHY_W(0x05, 0xfff6),
+    PHY_W(0x06, 0x0080),
+    PHY_CLR(0x00, BIT_7),
+    PHY_W(0x1f, 0x0002),
+    PHY_CLR(0x08, BIT_7),
+    PHY_W(0x1f, 0x0000),
+    PHY_W(0x1f, 0x0007),
+    PHY_W(0x1e, 0x0023),
+    PHY_W(0x16, 0x0306),
+    PHY_W(0x16, 0x0307),
+    PHY_W(0x15, 0x000e),
+    PHY_W(0x19, 0x000a),
+    PHY_W(0x15, 0x0010),
+    PHY_W(0x19, 0x0008),
+    PHY_W(0x15, 0x0018),
+    PHY_W(0x19, 0x4801),
+    PHY_W(0x15, 0x0019),
+    PHY_W(0x19, 0x6801),
+    PHY_W(0x15, 0x001a),
+    PHY_W(0x19, 0x66a1),
+    PHY_W(0x15, 0x001f),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0020),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0021),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0022),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0023),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0024),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0025),
+    PHY_W(0x19, 0x64a1),
+    PHY_W(0x15, 0x0026),
+    PHY_W(0x19, 0x40ea),
+    PHY_W(0x15, 0x0027),
+    PHY_W(0x19, 0x4503),
+    PHY_W(0x15, 0x0028),
+    PHY_W(0x19, 0x9f00),
+    PHY_W(0x15, 0x0029),
+    PHY_W(0x19, 0xa631),
+    PHY_W(0x15, 0x002a),
+    PHY_W(0x19, 0x9717),
+    PHY_W(0x15, 0x002b),
+    PHY_W(0x19, 0x302c),
+    PHY_W(0x15, 0x002c),
+    PHY_W(0x19, 0x4802),
+    PHY_W(0x15, 0x002d),
+    PHY_W(0x19, 0x58da),
+    PHY_W(0x15, 0x002e),
+    PHY_W(0x19, 0x400d),
+    PHY_W(0x15, 0x002f),
+    PHY_W(0x19, 0x4488),
+    PHY_W(0x15, 0x0030),
+    PHY_W(0x19, 0x9e00),
+    PHY_W(0x15, 0x0031),
+    PHY_W(0x19, 0x63c8),
+    PHY_W(0x15, 0x0032),
+    PHY_W(0x19, 0x6481),
+    PHY_W(0x15, 0x0033),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0034),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0035),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0036),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0037),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0038),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0039),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x003a),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x003b),
+    PHY_W(0x19, 0x63e8),
+    PHY_W(0x15, 0x003c),
+    PHY_W(0x19, 0x7d00),
+    PHY_W(0x15, 0x003d),
+    PHY_W(0x19, 0x59d4),
+    PHY_W(0x15, 0x003e),
+    PHY_W(0x19, 0x63f8),
+    PHY_W(0x15, 0x0040),
+    PHY_W(0x19, 0x64a1),
+    PHY_W(0x15, 0x0041),
+    PHY_W(0x19, 0x30de),
+    PHY_W(0x15, 0x0044),
+    PHY_W(0x19, 0x480f),
+    PHY_W(0x15, 0x0045),
+    PHY_W(0x19, 0x6800),
+    PHY_W(0x15, 0x0046),
+    PHY_W(0x19, 0x6680),
+    PHY_W(0x15, 0x0047),
+    PHY_W(0x19, 0x7c10),
+    PHY_W(0x15, 0x0048),
+    PHY_W(0x19, 0x63c8),
+    PHY_W(0x15, 0x0049),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x004a),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x004b),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x004c),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x004d),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x004e),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x004f),
+    PHY_W(0x19, 0x40ea),
+    PHY_W(0x15, 0x0050),
+    PHY_W(0x19, 0x4503),
+    PHY_W(0x15, 0x0051),
+    PHY_W(0x19, 0x58ca),
+    PHY_W(0x15, 0x0052),
+    PHY_W(0x19, 0x63c8),
+    PHY_W(0x15, 0x0053),
+    PHY_W(0x19, 0x63d8),
+    PHY_W(0x15, 0x0054),
+    PHY_W(0x19, 0x66a0),
+    PHY_W(0x15, 0x0055),
+    PHY_W(0x19, 0x9f00),
+    PHY_W(0x15, 0x0056),
+    PHY_W(0x19, 0x3000),
+    PHY_W(0x15, 0x006e),
+    PHY_W(0x19, 0x9afa),
+    PHY_W(0x15, 0x00a1),
+    PHY_W(0x19, 0x3044),
+    PHY_W(0x15, 0x00ab),
+    PHY_W(0x19, 0x5820),
+    PHY_W(0x15, 0x00ac),
+    PHY_W(0x19, 0x5e04),
+    PHY_W(0x15, 0x00ad),
+    PHY_W(0x19, 0xb60c),
+    PHY_W(0x15, 0x00af),
+    PHY_W(0x19, 0x000a),
+    PHY_W(0x15, 0x00b2),
+    PHY_W(0x19, 0x30b9),
+    PHY_W(0x15, 0x00b9),
+    PHY_W(0x19, 0x4408),
+    PHY_W(0x15, 0x00ba),
+    PHY_W(0x19, 0x480b),
+    PHY_W(0x15, 0x00bb),
+    PHY_W(0x19, 0x5e00),
+    PHY_W(0x15, 0x00bc),
+    PHY_W(0x19, 0x405f),
+    PHY_W(0x15, 0x00bd),
+    PHY_W(0x19, 0x4448),
+    PHY_W(0x15, 0x00be),
+    PHY_W(0x19, 0x4020),
+    PHY_W(0x15, 0x00bf),
+    PHY_W(0x19, 0x4468),
+    PHY_W(0x15, 0x00c0),
+    PHY_W(0x19, 0x9c02),
+    PHY_W(0x15, 0x00c1),
+    PHY_W(0x19, 0x58a0),
+    PHY_W(0x15, 0x00c2),
+    PHY_W(0x19, 0xb605),
+    PHY_W(0x15, 0x00c3),
+    PHY_W(0x19, 0xc0d3),
+    PHY_W(0x15, 0x00c4),
+    PHY_W(0x19, 0x00e6),
+    PHY_W(0x15, 0x00c5),
+    PHY_W(0x19, 0xdaec),
+    PHY_W(0x15, 0x00c6),
+    PHY_W(0x19, 0x00fa),
+    PHY_W(0x15, 0x00c7),
+    PHY_W(0x19, 0x9df9),
+    PHY_W(0x15, 0x00c8),
+    PHY_W(0x19, 0x307a),
+    PHY_W(0x15, 0x0112),
+    PHY_W(0x19, 0x6421),
+    PHY_W(0x15, 0x0113),
+    PHY_W(0x19, 0x7c08),
+    PHY_W(0x15, 0x0114),
+    PHY_W(0x19, 0x63f0),
+    PHY_W(0x15, 0x0115),
+    PHY_W(0x19, 0x4003),
+    PHY_W(0x15, 0x0116),
+    PHY_W(0x19, 0x4418),
+    PHY_W(0x15, 0x0117),
+    PHY_W(0x19, 0x9b00),
+    PHY_W(0x15, 0x0118),
+    PHY_W(0x19, 0x6461),
+    PHY_W(0x15, 0x0119),
+    PHY_W(0x19, 0x64e1),
+    PHY_W(0x15, 0x011a),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0150),
+    PHY_W(0x19, 0x6461),
+    PHY_W(0x15, 0x0151),
+    PHY_W(0x19, 0x4003),
+    PHY_W(0x15, 0x0152),
+    PHY_W(0x19, 0x4540),
+    PHY_W(0x15, 0x0153),
+    PHY_W(0x19, 0x9f00),
+    PHY_W(0x15, 0x0155),
+    PHY_W(0x19, 0x6421),
+    PHY_W(0x15, 0x0156),
+    PHY_W(0x19, 0x64a1),
+    PHY_W(0x15, 0x021e),
+    PHY_W(0x19, 0x5410),
+    PHY_W(0x15, 0x0225),
+    PHY_W(0x19, 0x5400),
+    PHY_W(0x15, 0x023d),
+    PHY_W(0x19, 0x4050),
+    PHY_W(0x15, 0x0295),
+    PHY_W(0x19, 0x6c08),
+    PHY_W(0x15, 0x02bd),
+    PHY_W(0x19, 0xa523),
+    PHY_W(0x15, 0x02be),
+    PHY_W(0x19, 0x32ca),
+    PHY_W(0x15, 0x02ca),
+    PHY_W(0x19, 0x48b3),
+    PHY_W(0x15, 0x02cb),
+    PHY_W(0x19, 0x4020),
+    PHY_W(0x15, 0x02cc),
+    PHY_W(0x19, 0x4823),
+    PHY_W(0x15, 0x02cd),
+    PHY_W(0x19, 0x4510),
+    PHY_W(0x15, 0x02ce),
+    PHY_W(0x19, 0xb63a),
+    PHY_W(0x15, 0x02cf),
+    PHY_W(0x19, 0x7dc8),
+    PHY_W(0x15, 0x02d6),
+    PHY_W(0x19, 0x9bf8),
+    PHY_W(0x15, 0x02d8),
+    PHY_W(0x19, 0x85f6),
+    PHY_W(0x15, 0x02d9),
+    PHY_W(0x19, 0x32e0),
+    PHY_W(0x15, 0x02e0),
+    PHY_W(0x19, 0x4834),
+    PHY_W(0x15, 0x02e1),
+    PHY_W(0x19, 0x6c08),
+    PHY_W(0x15, 0x02e2),
+    PHY_W(0x19, 0x4020),
+    PHY_W(0x15, 0x02e3),
+    PHY_W(0x19, 0x4824),
+    PHY_W(0x15, 0x02e4),
+    PHY_W(0x19, 0x4520),
+    PHY_W(0x15, 0x02e5),
+    PHY_W(0x19, 0x4008),
+    PHY_W(0x15, 0x02e6),
+    PHY_W(0x19, 0x4560),
+    PHY_W(0x15, 0x02e7),
+    PHY_W(0x19, 0x9d04),
+    PHY_W(0x15, 0x02e8),
+    PHY_W(0x19, 0x48c4),
+    PHY_W(0x15, 0x02e9),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x02ea),
+    PHY_W(0x19, 0x4844),
+    PHY_W(0x15, 0x02eb),
+    PHY_W(0x19, 0x7dc8),
+    PHY_W(0x15, 0x02f0),
+    PHY_W(0x19, 0x9cf7),
+    PHY_W(0x15, 0x02f1),
+    PHY_W(0x19, 0xdf94),
+    PHY_W(0x15, 0x02f2),
+    PHY_W(0x19, 0x0002),
+    PHY_W(0x15, 0x02f3),
+    PHY_W(0x19, 0x6810),
+    PHY_W(0x15, 0x02f4),
+    PHY_W(0x19, 0xb614),
+    PHY_W(0x15, 0x02f5),
+    PHY_W(0x19, 0xc42b),
+    PHY_W(0x15, 0x02f6),
+    PHY_W(0x19, 0x00d4),
+    PHY_W(0x15, 0x02f7),
+    PHY_W(0x19, 0xc455),
+    PHY_W(0x15, 0x02f8),
+    PHY_W(0x19, 0x0093),
+    PHY_W(0x15, 0x02f9),
+    PHY_W(0x19, 0x92ee),
+    PHY_W(0x15, 0x02fa),
+    PHY_W(0x19, 0xefed),
+    PHY_W(0x15, 0x02fb),
+    PHY_W(0x19, 0x3312),
+    PHY_W(0x15, 0x0312),
+    PHY_W(0x19, 0x49b5),
+    PHY_W(0x15, 0x0313),
+    PHY_W(0x19, 0x7d00),
+    PHY_W(0x15, 0x0314),
+    PHY_W(0x19, 0x4d00),
+    PHY_W(0x15, 0x0315),
+    PHY_W(0x19, 0x6810),
+    PHY_W(0x15, 0x031e),
+    PHY_W(0x19, 0x404f),
+    PHY_W(0x15, 0x031f),
+    PHY_W(0x19, 0x44c8),
+    PHY_W(0x15, 0x0320),
+    PHY_W(0x19, 0xd64f),
+    PHY_W(0x15, 0x0321),
+    PHY_W(0x19, 0x00e7),
+    PHY_W(0x15, 0x0322),
+    PHY_W(0x19, 0x7c08),
+    PHY_W(0x15, 0x0323),
+    PHY_W(0x19, 0x8203),
+    PHY_W(0x15, 0x0324),
+    PHY_W(0x19, 0x4d48),
+    PHY_W(0x15, 0x0325),
+    PHY_W(0x19, 0x3327),
+    PHY_W(0x15, 0x0326),
+    PHY_W(0x19, 0x4d40),
+    PHY_W(0x15, 0x0327),
+    PHY_W(0x19, 0xc8d7),
+    PHY_W(0x15, 0x0328),
+    PHY_W(0x19, 0x0003),
+    PHY_W(0x15, 0x0329),
+    PHY_W(0x19, 0x7c20),
+    PHY_W(0x15, 0x032a),
+    PHY_W(0x19, 0x4c20),
+    PHY_W(0x15, 0x032b),
+    PHY_W(0x19, 0xc8ed),
+    PHY_W(0x15, 0x032c),
+    PHY_W(0x19, 0x00f4),
+    PHY_W(0x15, 0x032d),
+    PHY_W(0x19, 0x82b3),
+    PHY_W(0x15, 0x032e),
+    PHY_W(0x19, 0xd11d),
+    PHY_W(0x15, 0x032f),
+    PHY_W(0x19, 0x00b1),
+    PHY_W(0x15, 0x0330),
+    PHY_W(0x19, 0xde18),
+    PHY_W(0x15, 0x0331),
+    PHY_W(0x19, 0x0008),
+    PHY_W(0x15, 0x0332),
+    PHY_W(0x19, 0x91ee),
+    PHY_W(0x15, 0x0333),
+    PHY_W(0x19, 0x3339),
+    PHY_W(0x15, 0x033a),
+    PHY_W(0x19, 0x4064),
+    PHY_W(0x15, 0x0340),
+    PHY_W(0x19, 0x9e06),
+    PHY_W(0x15, 0x0341),
+    PHY_W(0x19, 0x7c08),
+    PHY_W(0x15, 0x0342),
+    PHY_W(0x19, 0x8203),
+    PHY_W(0x15, 0x0343),
+    PHY_W(0x19, 0x4d48),
+    PHY_W(0x15, 0x0344),
+    PHY_W(0x19, 0x3346),
+    PHY_W(0x15, 0x0345),
+    PHY_W(0x19, 0x4d40),
+    PHY_W(0x15, 0x0346),
+    PHY_W(0x19, 0xd11d),
+    PHY_W(0x15, 0x0347),
+    PHY_W(0x19, 0x0099),
+    PHY_W(0x15, 0x0348),
+    PHY_W(0x19, 0xbb17),
+    PHY_W(0x15, 0x0349),
+    PHY_W(0x19, 0x8102),
+    PHY_W(0x15, 0x034a),
+    PHY_W(0x19, 0x334d),
+    PHY_W(0x15, 0x034b),
+    PHY_W(0x19, 0xa22c),
+    PHY_W(0x15, 0x034c),
+    PHY_W(0x19, 0x3397),
+    PHY_W(0x15, 0x034d),
+    PHY_W(0x19, 0x91f2),
+    PHY_W(0x15, 0x034e),
+    PHY_W(0x19, 0xc218),
+    PHY_W(0x15, 0x034f),
+    PHY_W(0x19, 0x00f0),
+    PHY_W(0x15, 0x0350),
+    PHY_W(0x19, 0x3397),
+    PHY_W(0x15, 0x0351),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0364),
+    PHY_W(0x19, 0xbc05),
+    PHY_W(0x15, 0x0367),
+    PHY_W(0x19, 0xa1fc),
+    PHY_W(0x15, 0x0368),
+    PHY_W(0x19, 0x3377),
+    PHY_W(0x15, 0x0369),
+    PHY_W(0x19, 0x328b),
+    PHY_W(0x15, 0x036a),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x15, 0x0377),
+    PHY_W(0x19, 0x4b97),
+    PHY_W(0x15, 0x0378),
+    PHY_W(0x19, 0x6818),
+    PHY_W(0x15, 0x0379),
+    PHY_W(0x19, 0x4b07),
+    PHY_W(0x15, 0x037a),
+    PHY_W(0x19, 0x40ac),
+    PHY_W(0x15, 0x037b),
+    PHY_W(0x19, 0x4445),
+    PHY_W(0x15, 0x037c),
+    PHY_W(0x19, 0x404e),
+    PHY_W(0x15, 0x037d),
+    PHY_W(0x19, 0x4461),
+    PHY_W(0x15, 0x037e),
+    PHY_W(0x19, 0x9c09),
+    PHY_W(0x15, 0x037f),
+    PHY_W(0x19, 0x63da),
+    PHY_W(0x15, 0x0380),
+    PHY_W(0x19, 0x5440),
+    PHY_W(0x15, 0x0381),
+    PHY_W(0x19, 0x4b98),
+    PHY_W(0x15, 0x0382),
+    PHY_W(0x19, 0x7c60),
+    PHY_W(0x15, 0x0383),
+    PHY_W(0x19, 0x4c00),
+    PHY_W(0x15, 0x0384),
+    PHY_W(0x19, 0x4b08),
+    PHY_W(0x15, 0x0385),
+    PHY_W(0x19, 0x63d8),
+    PHY_W(0x15, 0x0386),
+    PHY_W(0x19, 0x338d),
+    PHY_W(0x15, 0x0387),
+    PHY_W(0x19, 0xd64f),
+    PHY_W(0x15, 0x0388),
+    PHY_W(0x19, 0x0080),
+    PHY_W(0x15, 0x0389),
+    PHY_W(0x19, 0x820c),
+    PHY_W(0x15, 0x038a),
+    PHY_W(0x19, 0xa10b),
+    PHY_W(0x15, 0x038b),
+    PHY_W(0x19, 0x9df3),
+    PHY_W(0x15, 0x038c),
+    PHY_W(0x19, 0x3395),
+    PHY_W(0x15, 0x038d),
+    PHY_W(0x19, 0xd64f),
+    PHY_W(0x15, 0x038e),
+    PHY_W(0x19, 0x00f9),
+    PHY_W(0x15, 0x038f),
+    PHY_W(0x19, 0xc017),
+    PHY_W(0x15, 0x0390),
+    PHY_W(0x19, 0x0005),
+    PHY_W(0x15, 0x0391),
+    PHY_W(0x19, 0x6c0b),
+    PHY_W(0x15, 0x0392),
+    PHY_W(0x19, 0xa103),
+    PHY_W(0x15, 0x0393),
+    PHY_W(0x19, 0x6c08),
+    PHY_W(0x15, 0x0394),
+    PHY_W(0x19, 0x9df9),
+    PHY_W(0x15, 0x0395),
+    PHY_W(0x19, 0x6c08),
+    PHY_W(0x15, 0x0396),
+    PHY_W(0x19, 0x3397),
+    PHY_W(0x15, 0x0399),
+    PHY_W(0x19, 0x6810),
+    PHY_W(0x15, 0x03a4),
+    PHY_W(0x19, 0x7c08),
+    PHY_W(0x15, 0x03a5),
+    PHY_W(0x19, 0x8203),
+    PHY_W(0x15, 0x03a6),
+    PHY_W(0x19, 0x4d08),
+    PHY_W(0x15, 0x03a7),
+    PHY_W(0x19, 0x33a9),
+    PHY_W(0x15, 0x03a8),
+    PHY_W(0x19, 0x4d00),
+    PHY_W(0x15, 0x03a9),
+    PHY_W(0x19, 0x9bfa),
+    PHY_W(0x15, 0x03aa),
+    PHY_W(0x19, 0x33b6),
+    PHY_W(0x15, 0x03bb),
+    PHY_W(0x19, 0x4056),
+    PHY_W(0x15, 0x03bc),
+    PHY_W(0x19, 0x44e9),
+    PHY_W(0x15, 0x03bd),
+    PHY_W(0x19, 0x4054),
+    PHY_W(0x15, 0x03be),
+    PHY_W(0x19, 0x44f8),
+    PHY_W(0x15, 0x03bf),
+    PHY_W(0x19, 0xd64f),
+    PHY_W(0x15, 0x03c0),
+    PHY_W(0x19, 0x0037),
+    PHY_W(0x15, 0x03c1),
+    PHY_W(0x19, 0xbd37),
+    PHY_W(0x15, 0x03c2),
+    PHY_W(0x19, 0x9cfd),
+    PHY_W(0x15, 0x03c3),
+    PHY_W(0x19, 0xc639),
+    PHY_W(0x15, 0x03c4),
+    PHY_W(0x19, 0x0011),
+    PHY_W(0x15, 0x03c5),
+    PHY_W(0x19, 0x9b03),
+    PHY_W(0x15, 0x03c6),
+    PHY_W(0x19, 0x7c01),
+    PHY_W(0x15, 0x03c7),
+    PHY_W(0x19, 0x4c01),
+    PHY_W(0x15, 0x03c8),
+    PHY_W(0x19, 0x9e03),
+    PHY_W(0x15, 0x03c9),
+    PHY_W(0x19, 0x7c20),
+    PHY_W(0x15, 0x03ca),
+    PHY_W(0x19, 0x4c20),
+    PHY_W(0x15, 0x03cb),
+    PHY_W(0x19, 0x9af4),
+    PHY_W(0x15, 0x03cc),
+    PHY_W(0x19, 0x7c12),
+    PHY_W(0x15, 0x03cd),
+    PHY_W(0x19, 0x4c52),
+    PHY_W(0x15, 0x03ce),
+    PHY_W(0x19, 0x4470),
+    PHY_W(0x15, 0x03cf),
+    PHY_W(0x19, 0x7c12),
+    PHY_W(0x15, 0x03d0),
+    PHY_W(0x19, 0x4c40),
+    PHY_W(0x15, 0x03d1),
+    PHY_W(0x19, 0x33bf),
+    PHY_W(0x15, 0x03d6),
+    PHY_W(0x19, 0x4047),
+    PHY_W(0x15, 0x03d7),
+    PHY_W(0x19, 0x4469),
+    PHY_W(0x15, 0x03d8),
+    PHY_W(0x19, 0x492b),
+    PHY_W(0x15, 0x03d9),
+    PHY_W(0x19, 0x4479),
+    PHY_W(0x15, 0x03da),
+    PHY_W(0x19, 0x7c09),
+    PHY_W(0x15, 0x03db),
+    PHY_W(0x19, 0x8203),
+    PHY_W(0x15, 0x03dc),
+    PHY_W(0x19, 0x4d48),
+    PHY_W(0x15, 0x03dd),
+    PHY_W(0x19, 0x33df),
+    PHY_W(0x15, 0x03de),
+    PHY_W(0x19, 0x4d40),
+    PHY_W(0x15, 0x03df),
+    PHY_W(0x19, 0xd64f),
+    PHY_W(0x15, 0x03e0),
+    PHY_W(0x19, 0x0017),
+    PHY_W(0x15, 0x03e1),
+    PHY_W(0x19, 0xbd17),
+    PHY_W(0x15, 0x03e2),
+    PHY_W(0x19, 0x9b03),
+    PHY_W(0x15, 0x03e3),
+    PHY_W(0x19, 0x7c20),
+    PHY_W(0x15, 0x03e4),
+    PHY_W(0x19, 0x4c20),
+    PHY_W(0x15, 0x03e5),
+    PHY_W(0x19, 0x88f5),
+    PHY_W(0x15, 0x03e6),
+    PHY_W(0x19, 0xc428),
+    PHY_W(0x15, 0x03e7),
+    PHY_W(0x19, 0x0008),
+    PHY_W(0x15, 0x03e8),
+    PHY_W(0x19, 0x9af2),
+    PHY_W(0x15, 0x03e9),
+    PHY_W(0x19, 0x7c12),
+    PHY_W(0x15, 0x03ea),
+    PHY_W(0x19, 0x4c52),
+    PHY_W(0x15, 0x03eb),
+    PHY_W(0x19, 0x4470),
+    PHY_W(0x15, 0x03ec),
+    PHY_W(0x19, 0x7c12),
+    PHY_W(0x15, 0x03ed),
+    PHY_W(0x19, 0x4c40),
+    PHY_W(0x15, 0x03ee),
+    PHY_W(0x19, 0x33da),
+    PHY_W(0x15, 0x03ef),
+    PHY_W(0x19, 0x3312),
+    PHY_W(0x16, 0x0306),
+    PHY_W(0x16, 0x0300),
+    PHY_W(0x1f, 0x0000),
+    PHY_W(0x17, 0x2179),
+    PHY_W(0x1f, 0x0007),
+    PHY_W(0x1e, 0x0040),
+    PHY_W(0x18, 0x0645),
+    PHY_W(0x19, 0xe200),
+    PHY_W(0x18, 0x0655),
+    PHY_W(0x19, 0x9000),
+    PHY_W(0x18, 0x0d05),
+    PHY_W(0x19, 0xbe00),
+    PHY_W(0x18, 0x0d15),
+    PHY_W(0x19, 0xd300),
+    PHY_W(0x18, 0x0d25),
+    PHY_W(0x19, 0xfe00),
+    PHY_W(0x18, 0x0d35),
+    PHY_W(0x19, 0x4000),
+    PHY_W(0x18, 0x0d45),
+    PHY_W(0x19, 0x7f00),
+    PHY_W(0x18, 0x0d55),
+    PHY_W(0x19, 0x1000),
+    PHY_W(0x18, 0x0d65),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x0d75),
+    PHY_W(0x19, 0x8200),
+    PHY_W(0x18, 0x0d85),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x0d95),
+    PHY_W(0x19, 0x7000),
+    PHY_W(0x18, 0x0da5),
+    PHY_W(0x19, 0x0f00),
+    PHY_W(0x18, 0x0db5),
+    PHY_W(0x19, 0x0100),
+    PHY_W(0x18, 0x0dc5),
+    PHY_W(0x19, 0x9b00),
+    PHY_W(0x18, 0x0dd5),
+    PHY_W(0x19, 0x7f00),
+    PHY_W(0x18, 0x0de5),
+    PHY_W(0x19, 0xe000),
+    PHY_W(0x18, 0x0df5),
+    PHY_W(0x19, 0xef00),
+    PHY_W(0x18, 0x16d5),
+    PHY_W(0x19, 0xe200),
+    PHY_W(0x18, 0x16e5),
+    PHY_W(0x19, 0xab00),
+    PHY_W(0x18, 0x2904),
+    PHY_W(0x19, 0x4000),
+    PHY_W(0x18, 0x2914),
+    PHY_W(0x19, 0x7f00),
+    PHY_W(0x18, 0x2924),
+    PHY_W(0x19, 0x0100),
+    PHY_W(0x18, 0x2934),
+    PHY_W(0x19, 0x2000),
+    PHY_W(0x18, 0x2944),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x2954),
+    PHY_W(0x19, 0x4600),
+    PHY_W(0x18, 0x2964),
+    PHY_W(0x19, 0xfc00),
+    PHY_W(0x18, 0x2974),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x2984),
+    PHY_W(0x19, 0x5000),
+    PHY_W(0x18, 0x2994),
+    PHY_W(0x19, 0x9d00),
+    PHY_W(0x18, 0x29a4),
+    PHY_W(0x19, 0xff00),
+    PHY_W(0x18, 0x29b4),
+    PHY_W(0x19, 0x4000),
+    PHY_W(0x18, 0x29c4),
+    PHY_W(0x19, 0x7f00),
+    PHY_W(0x18, 0x29d4),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x29e4),
+    PHY_W(0x19, 0x2000),
+    PHY_W(0x18, 0x29f4),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x2a04),
+    PHY_W(0x19, 0xe600),
+    PHY_W(0x18, 0x2a14),
+    PHY_W(0x19, 0xff00),
+    PHY_W(0x18, 0x2a24),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x2a34),
+    PHY_W(0x19, 0x5000),
+    PHY_W(0x18, 0x2a44),
+    PHY_W(0x19, 0x8500),
+    PHY_W(0x18, 0x2a54),
+    PHY_W(0x19, 0x7f00),
+    PHY_W(0x18, 0x2a64),
+    PHY_W(0x19, 0xac00),
+    PHY_W(0x18, 0x2a74),
+    PHY_W(0x19, 0x0800),
+    PHY_W(0x18, 0x2a84),
+    PHY_W(0x19, 0xfc00),
+    PHY_W(0x18, 0x2a94),
+    PHY_W(0x19, 0xe000),
+    PHY_W(0x18, 0x2aa4),
+    PHY_W(0x19, 0x7400),
+    PHY_W(0x18, 0x2ab4),
+    PHY_W(0x19, 0x4000),
+    PHY_W(0x18, 0x2ac4),
+    PHY_W(0x19, 0x7f00),
+    PHY_W(0x18, 0x2ad4),
+    PHY_W(0x19, 0x0100),
+    PHY_W(0x18, 0x2ae4),
+    PHY_W(0x19, 0xff00),
+    PHY_W(0x18, 0x2af4),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x2b04),
+    PHY_W(0x19, 0x4400),
+    PHY_W(0x18, 0x2b14),
+    PHY_W(0x19, 0xfc00),
+    PHY_W(0x18, 0x2b24),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x2b34),
+    PHY_W(0x19, 0x4000),
+    PHY_W(0x18, 0x2b44),
+    PHY_W(0x19, 0x9d00),
+    PHY_W(0x18, 0x2b54),
+    PHY_W(0x19, 0xff00),
+    PHY_W(0x18, 0x2b64),
+    PHY_W(0x19, 0x4000),
+    PHY_W(0x18, 0x2b74),
+    PHY_W(0x19, 0x7f00),
+    PHY_W(0x18, 0x2b84),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x2b94),
+    PHY_W(0x19, 0xff00),
+    PHY_W(0x18, 0x2ba4),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x2bb4),
+    PHY_W(0x19, 0xfc00),
+    PHY_W(0x18, 0x2bc4),
+    PHY_W(0x19, 0xff00),
+    PHY_W(0x18, 0x2bd4),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x2be4),
+    PHY_W(0x19, 0x4000),
+    PHY_W(0x18, 0x2bf4),
+    PHY_W(0x19, 0x8900),
+    PHY_W(0x18, 0x2c04),
+    PHY_W(0x19, 0x8300),
+    PHY_W(0x18, 0x2c14),
+    PHY_W(0x19, 0xe000),
+    PHY_W(0x18, 0x2c24),
+    PHY_W(0x19, 0x0000),
+    PHY_W(0x18, 0x2c34),
+    PHY_W(0x19, 0xac00),
+    PHY_W(0x18, 0x2c44),
+    PHY_W(0x19, 0x0800),
+    PHY_W(0x18, 0x2c54),
+    PHY_W(0x19, 0xfa00),
+    PHY_W(0x18, 0x2c64),
+    PHY_W(0x19, 0xe100),
+    PHY_W(0x18, 0x2c74),
+    PHY_W(0x19, 0x7f00),
+    PHY_W(0x18, 0x0001),
+    PHY_W(0x1f, 0x0000),
+    PHY_W(0x17, 0x2100),
+    PHY_W(0x1f, 0x0005),
+    PHY_W(0x05, 0xfff6),
+    PHY_W(0x06, 0x0080),
+    PHY_W(0x05, 0x8000),
+    PHY_W(0x06, 0xd480),
+    PHY_W(0x06, 0xc1e4),
+    PHY_W(0x06, 0x8b9a),
+    PHY_W(0x06, 0xe58b),
+    PHY_W(0x06, 0x9bee),
+    PHY_W(0x06, 0x8b83),
+    PHY_W(0x06, 0x41bf),
+    PHY_W(0x06, 0x8b88),
+    PHY_W(0x06, 0xec00),
+    PHY_W(0x06, 0x19a9),
+    PHY_W(0x06, 0x8b90),
+    PHY_W(0x06, 0xf9ee),
+    PHY_W(0x06, 0xfff6),
+    PHY_W(0x06, 0x00ee),
+    PHY_W(0x06, 0xfff7),
+    PHY_W(0x06, 0xffe0),
+    PHY_W(0x06, 0xe140),
+    PHY_W(0x06, 0xe1e1),
+    PHY_W(0x06, 0x41f7),
+    PHY_W(0x06, 0x2ff6),
+    PHY_W(0x06, 0x28e4),
+    PHY_W(0x06, 0xe140),
+    PHY_W(0x06, 0xe5e1),
+    PHY_W(0x06, 0x41f7),
+    PHY_W(0x06, 0x0002),
+    PHY_W(0x06, 0x020c),
+    PHY_W(0x06, 0x0202),
+    PHY_W(0x06, 0x1d02),
+    PHY_W(0x06, 0x0230),
+    PHY_W(0x06, 0x0202),
+    PHY_W(0x06, 0x4002),
+    PHY_W(0x06, 0x028b),
+    PHY_W(0x06, 0x0280),
+    PHY_W(0x06, 0x6c02),
+    PHY_W(0x06, 0x8085),
+    PHY_W(0x06, 0xe08b),
+    PHY_W(0x06, 0x88e1),
+    PHY_W(0x06, 0x8b89),
+    PHY_W(0x06, 0x1e01),
+    PHY_W(0x06, 0xe18b),
+    PHY_W(0x06, 0x8a1e),
+    PHY_W(0x06, 0x01e1),
+    PHY_W(0x06, 0x8b8b),
+    PHY_W(0x06, 0x1e01),
+    PHY_W(0x06, 0xe18b),
+    PHY_W(0x06, 0x8c1e),
+    PHY_W(0x06, 0x01e1),
+    PHY_W(0x06, 0x8b8d),
+    PHY_W(0x06, 0x1e01),
+    PHY_W(0x06, 0xe18b),
+    PHY_W(0x06, 0x8e1e),
+    PHY_W(0x06, 0x01a0),
+    PHY_W(0x06, 0x00c7),
+    PHY_W(0x06, 0xaec3),
+    PHY_W(0x06, 0xf8e0),
+    PHY_W(0x06, 0x8b8d),
+    PHY_W(0x06, 0xad20),
+    PHY_W(0x06, 0x10ee),
+    PHY_W(0x06, 0x8b8d),
+    PHY_W(0x06, 0x0002),
+    PHY_W(0x06, 0x1310),
+    PHY_W(0x06, 0x0280),
+    PHY_W(0x06, 0xc602),
+    PHY_W(0x06, 0x1f0c),
+    PHY_W(0x06, 0x0227),
+    PHY_W(0x06, 0x49fc),
+    PHY_W(0x06, 0x04f8),
+    PHY_W(0x06, 0xe08b),
+    PHY_W(0x06, 0x8ead),
+    PHY_W(0x06, 0x200b),
+    PHY_W(0x06, 0xf620),
+    PHY_W(0x06, 0xe48b),
+    PHY_W(0x06, 0x8e02),
+    PHY_W(0x06, 0x852d),
+    PHY_W(0x06, 0x021b),
+    PHY_W(0x06, 0x67ad),
+    PHY_W(0x06, 0x2211),
+    PHY_W(0x06, 0xf622),
+    PHY_W(0x06, 0xe48b),
+    PHY_W(0x06, 0x8e02),
+    PHY_W(0x06, 0x2ba5),
+    PHY_W(0x06, 0x022a),
+    PHY_W(0x06, 0x2402),
+    PHY_W(0x06, 0x82e5),
+    PHY_W(0x06, 0x022a),
+    PHY_W(0x06, 0xf0ad),
+    PHY_W(0x06, 0x2511),
+    PHY_W(0x06, 0xf625),
+    PHY_W(0x06, 0xe48b),
+    PHY_W(0x06, 0x8e02),
+    PHY_W(0x06, 0x8445),
+    PHY_W(0x06, 0x0204),
+    PHY_W(0x06, 0x0302),
+    PHY_W(0x06, 0x19cc),
+    PHY_W(0x06, 0x022b),
+    PHY_W(0x06, 0x5bfc),
+    PHY_W(0x06, 0x04ee),
+    PHY_W(0x06, 0x8b8d),
+    PHY_W(0x06, 0x0105),
+    PHY_W(0x06, 0xf8f9),
+    PHY_W(0x06, 0xfae0),
+    PHY_W(0x06, 0x8b81),
+    PHY_W(0x06, 0xac26),
+    PHY_W(0x06, 0x08e0),
+    PHY_W(0x06, 0x8b81),
+    PHY_W(0x06, 0xac21),
+    PHY_W(0x06, 0x02ae),
+    PHY_W(0x06, 0x6bee),
+    PHY_W(0x06, 0xe0ea),
+    PHY_W(0x06, 0x00ee),
+    PHY_W(0x06, 0xe0eb),
+    PHY_W(0x06, 0x00e2),
+    PHY_W(0x06, 0xe07c),
+    PHY_W(0x06, 0xe3e0),
+    PHY_W(0x06, 0x7da5),
+    PHY_W(0x06, 0x1111),
+    PHY_W(0x06, 0x15d2),
+    PHY_W(0x06, 0x60d6),
+    PHY_W(0x06, 0x6666),
+    PHY_W(0x06, 0x0207),
+    PHY_W(0x06, 0x6cd2),
+    PHY_W(0x06, 0xa0d6),
+    PHY_W(0x06, 0xaaaa),
+    PHY_W(0x06, 0x0207),
+    PHY_W(0x06, 0x6c02),
+    PHY_W(0x06, 0x201d),
+    PHY_W(0x06, 0xae44),
+    PHY_W(0x06, 0xa566),
+    PHY_W(0x06, 0x6602),
+    PHY_W(0x06, 0xae38),
+    PHY_W(0x06, 0xa5aa),
+    PHY_W(0x06, 0xaa02),
+    PHY_W(0x06, 0xae32),
+    PHY_W(0x06, 0xeee0),
+    PHY_W(0x06, 0xea04),
+    PHY_W(0x06, 0xeee0),
+    PHY_W(0x06, 0xeb06),
+    PHY_W(0x06, 0xe2e0),
+    PHY_W(0x06, 0x7ce3),
+    PHY_W(0x06, 0xe07d),
+    PHY_W(0x06, 0xe0e0),
+    PHY_W(0x06, 0x38e1),
+    PHY_W(0x06, 0xe039),
+    PHY_W(0x06, 0xad2e),
+    PHY_W(0x06, 0x21ad),
+    PHY_W(0x06, 0x3f13),
+    PHY_W(0x06, 0xe0e4),
+    PHY_W(0x06, 0x14e1),
+    PHY_W(0x06, 0xe415),
+    PHY_W(0x06, 0x6880),
+    PHY_W(0x06, 0xe4e4),
+    PHY_W(0x06, 0x14e5),
+    PHY_W(0x06, 0xe415),
+    PHY_W(0x06, 0x0220),
+    PHY_W(0x06, 0x1dae),
+    PHY_W(0x06, 0x0bac),
+    PHY_W(0x06, 0x3e02),
+    PHY_W(0x06, 0xae06),
+    PHY_W(0x06, 0x0281),
+    PHY_W(0x06, 0x4602),
+    PHY_W(0x06, 0x2057),
+    PHY_W(0x06, 0xfefd),
+    PHY_W(0x06, 0xfc04),
+    PHY_W(0x06, 0xf8e0),
+    PHY_W(0x06, 0x8b81),
+    PHY_W(0x06, 0xad26),
+    PHY_W(0x06, 0x0302),
+    PHY_W(0x06, 0x20a7),
+    PHY_W(0x06, 0xe08b),
+    PHY_W(0x06, 0x81ad),
+    PHY_W(0x06, 0x2109),
+    PHY_W(0x06, 0xe08b),
+    PHY_W(0x06, 0x2eac),
+    PHY_W(0x06, 0x2003),
+    PHY_W(0x06, 0x0281),
+    PHY_W(0x06, 0x61fc),
+    PHY_W(0x06, 0x04f8),
+    PHY_W(0x06, 0xe08b),
+    PHY_W(0x06, 0x81ac),
+    PHY_W(0x06, 0x2505),
+    PHY_W(0x06, 0x0222),
+    PHY_W(0x06, 0xaeae),
+    PHY_W(0x06, 0x0302),
+    PHY_W(0x06, 0x8172),
+    PHY_W(0x06, 0xfc04),
+    PHY_W(0x06, 0xf8f9),
+    PHY_W(0x06, 0xfaef),
+    PHY_W(0x06, 0x69fa),
+    PHY_W(0x06, 0xe086),
+    PHY_W(0x06, 0x20a0),
+    PHY_W(0x06, 0x8016),
+    PHY_W(0x06, 0xe086),
+    PHY_W(0x06, 0x21e1),
+    PHY_W(0x06, 0x8b33),
+    PHY_W(0x06, 0x1b10),
+    PHY_W(0x06, 0x9e06),
+    PHY_W(0x06, 0x0223),
+    PHY_W(0x06, 0x91af),
+    PHY_W(0x06, 0x8252),
+    PHY_W(0x06, 0xee86),
+    PHY_W(0x06, 0x2081),
+    PHY_W(0x06, 0xaee4),
+    PHY_W(0x06, 0xa081),
+    PHY_W(0x06, 0x1402),
+    PHY_W(0x06, 0x2399),
+    PHY_W(0x06, 0xbf25),
+    PHY_W(0x06, 0xcc02),
+    PHY_W(0x06, 0x2d21),
+    PHY_W(0x06, 0xee86),
+    PHY_W(0x06, 0x2100),
+    PHY_W(0x06, 0xee86),
+    PHY_W(0x06, 0x2082),
+    PHY_W(0x06, 0xaf82),
+    PHY_W(0x06, 0x52a0),
+    PHY_W(0x06, 0x8232),
+    PHY_W(0x06, 0xe086),
+    PHY_W(0x06, 0x21e1),
+    PHY_W(0x06, 0x8b32),
+    PHY_W(0x06, 0x1b10),
+    PHY_W(0x06, 0x9e06),
+    PHY_W(0x06, 0x0223),
+    PHY_W(0x06, 0x91af),
+    PHY_W(0x06, 0x8252),
+    PHY_W(0x06, 0xee86),
+    PHY_W(0x06, 0x2100),
+    PHY_W(0x06, 0xd000),
+    PHY_W(0x06, 0x0282),
+    PHY_W(0x06, 0x5910),
+    PHY_W(0x06, 0xa004),
+    PHY_W(0x06, 0xf9e0),
+    PHY_W(0x06, 0x861f),
+    PHY_W(0x06, 0xa000),
+    PHY_W(0x06, 0x07ee),
+    PHY_W(0x06, 0x8620),
+    PHY_W(0x06, 0x83af),
+    PHY_W(0x06, 0x8178),
+    PHY_W(0x06, 0x0224),
+    PHY_W(0x06, 0x0102),
+    PHY_W(0x06, 0x2399),
+    PHY_W(0x06, 0xae72),
+    PHY_W(0x06, 0xa083),
+    PHY_W(0x06, 0x4b1f),
+    PHY_W(0x06, 0x55d0),
+    PHY_W(0x06, 0x04bf),
+    PHY_W(0x06, 0x8615),
+    PHY_W(0x06, 0x1a90),
+    PHY_W(0x06, 0x0c54),
+    PHY_W(0x06, 0xd91e),
+    PHY_W(0x06, 0x31b0),
+    PHY_W(0x06, 0xf4e0),
+    PHY_W(0x06, 0xe022),
+    PHY_W(0x06, 0xe1e0),
+    PHY_W(0x06, 0x23ad),
+    PHY_W(0x06, 0x2e0c),
+    PHY_W(0x06, 0xef02),
+    PHY_W(0x06, 0xef12),
+    PHY_W(0x06, 0x0e44),
+    PHY_W(0x06, 0xef23),
+    PHY_W(0x06, 0x0e54),
+    PHY_W(0x06, 0xef21),
+    PHY_W(0x06, 0xe6e4),
+    PHY_W(0x06, 0x2ae7),
+    PHY_W(0x06, 0xe42b),
+    PHY_W(0x06, 0xe2e4),
+    PHY_W(0x06, 0x28e3),
+    PHY_W(0x06, 0xe429),
+    PHY_W(0x06, 0x6d20),
+    PHY_W(0x06, 0x00e6),
+    PHY_W(0x06, 0xe428),
+    PHY_W(0x06, 0xe7e4),
+    PHY_W(0x06, 0x29bf),
+    PHY_W(0x06, 0x25ca),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0x21ee),
+    PHY_W(0x06, 0x8620),
+    PHY_W(0x06, 0x84ee),
+    PHY_W(0x06, 0x8621),
+    PHY_W(0x06, 0x00af),
+    PHY_W(0x06, 0x8178),
+    PHY_W(0x06, 0xa084),
+    PHY_W(0x06, 0x19e0),
+    PHY_W(0x06, 0x8621),
+    PHY_W(0x06, 0xe18b),
+    PHY_W(0x06, 0x341b),
+    PHY_W(0x06, 0x109e),
+    PHY_W(0x06, 0x0602),
+    PHY_W(0x06, 0x2391),
+    PHY_W(0x06, 0xaf82),
+    PHY_W(0x06, 0x5202),
+    PHY_W(0x06, 0x241f),
+    PHY_W(0x06, 0xee86),
+    PHY_W(0x06, 0x2085),
+    PHY_W(0x06, 0xae08),
+    PHY_W(0x06, 0xa085),
+    PHY_W(0x06, 0x02ae),
+    PHY_W(0x06, 0x0302),
+    PHY_W(0x06, 0x2442),
+    PHY_W(0x06, 0xfeef),
+    PHY_W(0x06, 0x96fe),
+    PHY_W(0x06, 0xfdfc),
+    PHY_W(0x06, 0x04f8),
+    PHY_W(0x06, 0xf9fa),
+    PHY_W(0x06, 0xef69),
+    PHY_W(0x06, 0xfad1),
+    PHY_W(0x06, 0x801f),
+    PHY_W(0x06, 0x66e2),
+    PHY_W(0x06, 0xe0ea),
+    PHY_W(0x06, 0xe3e0),
+    PHY_W(0x06, 0xeb5a),
+    PHY_W(0x06, 0xf81e),
+    PHY_W(0x06, 0x20e6),
+    PHY_W(0x06, 0xe0ea),
+    PHY_W(0x06, 0xe5e0),
+    PHY_W(0x06, 0xebd3),
+    PHY_W(0x06, 0x05b3),
+    PHY_W(0x06, 0xfee2),
+    PHY_W(0x06, 0xe07c),
+    PHY_W(0x06, 0xe3e0),
+    PHY_W(0x06, 0x7dad),
+    PHY_W(0x06, 0x3703),
+    PHY_W(0x06, 0x7dff),
+    PHY_W(0x06, 0xff0d),
+    PHY_W(0x06, 0x581c),
+    PHY_W(0x06, 0x55f8),
+    PHY_W(0x06, 0xef46),
+    PHY_W(0x06, 0x0282),
+    PHY_W(0x06, 0xc7ef),
+    PHY_W(0x06, 0x65ef),
+    PHY_W(0x06, 0x54fc),
+    PHY_W(0x06, 0xac30),
+    PHY_W(0x06, 0x2b11),
+    PHY_W(0x06, 0xa188),
+    PHY_W(0x06, 0xcabf),
+    PHY_W(0x06, 0x860e),
+    PHY_W(0x06, 0xef10),
+    PHY_W(0x06, 0x0c11),
+    PHY_W(0x06, 0x1a91),
+    PHY_W(0x06, 0xda19),
+    PHY_W(0x06, 0xdbf8),
+    PHY_W(0x06, 0xef46),
+    PHY_W(0x06, 0x021e),
+    PHY_W(0x06, 0x17ef),
+    PHY_W(0x06, 0x54fc),
+    PHY_W(0x06, 0xad30),
+    PHY_W(0x06, 0x0fef),
+    PHY_W(0x06, 0x5689),
+    PHY_W(0x06, 0xde19),
+    PHY_W(0x06, 0xdfe2),
+    PHY_W(0x06, 0x861f),
+    PHY_W(0x06, 0xbf86),
+    PHY_W(0x06, 0x161a),
+    PHY_W(0x06, 0x90de),
+    PHY_W(0x06, 0xfeef),
+    PHY_W(0x06, 0x96fe),
+    PHY_W(0x06, 0xfdfc),
+    PHY_W(0x06, 0x04ac),
+    PHY_W(0x06, 0x2707),
+    PHY_W(0x06, 0xac37),
+    PHY_W(0x06, 0x071a),
+    PHY_W(0x06, 0x54ae),
+    PHY_W(0x06, 0x11ac),
+    PHY_W(0x06, 0x3707),
+    PHY_W(0x06, 0xae00),
+    PHY_W(0x06, 0x1a54),
+    PHY_W(0x06, 0xac37),
+    PHY_W(0x06, 0x07d0),
+    PHY_W(0x06, 0x01d5),
+    PHY_W(0x06, 0xffff),
+    PHY_W(0x06, 0xae02),
+    PHY_W(0x06, 0xd000),
+    PHY_W(0x06, 0x04f8),
+    PHY_W(0x06, 0xe08b),
+    PHY_W(0x06, 0x83ad),
+    PHY_W(0x06, 0x2444),
+    PHY_W(0x06, 0xe0e0),
+    PHY_W(0x06, 0x22e1),
+    PHY_W(0x06, 0xe023),
+    PHY_W(0x06, 0xad22),
+    PHY_W(0x06, 0x3be0),
+    PHY_W(0x06, 0x8abe),
+    PHY_W(0x06, 0xa000),
+    PHY_W(0x06, 0x0502),
+    PHY_W(0x06, 0x28de),
+    PHY_W(0x06, 0xae42),
+    PHY_W(0x06, 0xa001),
+    PHY_W(0x06, 0x0502),
+    PHY_W(0x06, 0x28f1),
+    PHY_W(0x06, 0xae3a),
+    PHY_W(0x06, 0xa002),
+    PHY_W(0x06, 0x0502),
+    PHY_W(0x06, 0x8344),
+    PHY_W(0x06, 0xae32),
+    PHY_W(0x06, 0xa003),
+    PHY_W(0x06, 0x0502),
+    PHY_W(0x06, 0x299a),
+    PHY_W(0x06, 0xae2a),
+    PHY_W(0x06, 0xa004),
+    PHY_W(0x06, 0x0502),
+    PHY_W(0x06, 0x29ae),
+    PHY_W(0x06, 0xae22),
+    PHY_W(0x06, 0xa005),
+    PHY_W(0x06, 0x0502),
+    PHY_W(0x06, 0x29d7),
+    PHY_W(0x06, 0xae1a),
+    PHY_W(0x06, 0xa006),
+    PHY_W(0x06, 0x0502),
+    PHY_W(0x06, 0x29fe),
+    PHY_W(0x06, 0xae12),
+    PHY_W(0x06, 0xee8a),
+    PHY_W(0x06, 0xc000),
+    PHY_W(0x06, 0xee8a),
+    PHY_W(0x06, 0xc100),
+    PHY_W(0x06, 0xee8a),
+    PHY_W(0x06, 0xc600),
+    PHY_W(0x06, 0xee8a),
+    PHY_W(0x06, 0xbe00),
+    PHY_W(0x06, 0xae00),
+    PHY_W(0x06, 0xfc04),
+    PHY_W(0x06, 0xf802),
+    PHY_W(0x06, 0x2a67),
+    PHY_W(0x06, 0xe0e0),
+    PHY_W(0x06, 0x22e1),
+    PHY_W(0x06, 0xe023),
+    PHY_W(0x06, 0x0d06),
+    PHY_W(0x06, 0x5803),
+    PHY_W(0x06, 0xa002),
+    PHY_W(0x06, 0x02ae),
+    PHY_W(0x06, 0x2da0),
+    PHY_W(0x06, 0x0102),
+    PHY_W(0x06, 0xae2d),
+    PHY_W(0x06, 0xa000),
+    PHY_W(0x06, 0x4de0),
+    PHY_W(0x06, 0xe200),
+    PHY_W(0x06, 0xe1e2),
+    PHY_W(0x06, 0x01ad),
+    PHY_W(0x06, 0x2444),
+    PHY_W(0x06, 0xe08a),
+    PHY_W(0x06, 0xc2e4),
+    PHY_W(0x06, 0x8ac4),
+    PHY_W(0x06, 0xe08a),
+    PHY_W(0x06, 0xc3e4),
+    PHY_W(0x06, 0x8ac5),
+    PHY_W(0x06, 0xee8a),
+    PHY_W(0x06, 0xbe03),
+    PHY_W(0x06, 0xe08b),
+    PHY_W(0x06, 0x83ad),
+    PHY_W(0x06, 0x253a),
+    PHY_W(0x06, 0xee8a),
+    PHY_W(0x06, 0xbe05),
+    PHY_W(0x06, 0xae34),
+    PHY_W(0x06, 0xe08a),
+    PHY_W(0x06, 0xceae),
+    PHY_W(0x06, 0x03e0),
+    PHY_W(0x06, 0x8acf),
+    PHY_W(0x06, 0xe18a),
+    PHY_W(0x06, 0xc249),
+    PHY_W(0x06, 0x05e5),
+    PHY_W(0x06, 0x8ac4),
+    PHY_W(0x06, 0xe18a),
+    PHY_W(0x06, 0xc349),
+    PHY_W(0x06, 0x05e5),
+    PHY_W(0x06, 0x8ac5),
+    PHY_W(0x06, 0xee8a),
+    PHY_W(0x06, 0xbe05),
+    PHY_W(0x06, 0x022a),
+    PHY_W(0x06, 0xb6ac),
+    PHY_W(0x06, 0x2012),
+    PHY_W(0x06, 0x0283),
+    PHY_W(0x06, 0xbaac),
+    PHY_W(0x06, 0x200c),
+    PHY_W(0x06, 0xee8a),
+    PHY_W(0x06, 0xc100),
+    PHY_W(0x06, 0xee8a),
+    PHY_W(0x06, 0xc600),
+    PHY_W(0x06, 0xee8a),
+    PHY_W(0x06, 0xbe02),
+    PHY_W(0x06, 0xfc04),
+    PHY_W(0x06, 0xd000),
+    PHY_W(0x06, 0x0283),
+    PHY_W(0x06, 0xcc59),
+    PHY_W(0x06, 0x0f39),
+    PHY_W(0x06, 0x02aa),
+    PHY_W(0x06, 0x04d0),
+    PHY_W(0x06, 0x01ae),
+    PHY_W(0x06, 0x02d0),
+    PHY_W(0x06, 0x0004),
+    PHY_W(0x06, 0xf9fa),
+    PHY_W(0x06, 0xe2e2),
+    PHY_W(0x06, 0xd2e3),
+    PHY_W(0x06, 0xe2d3),
+    PHY_W(0x06, 0xf95a),
+    PHY_W(0x06, 0xf7e6),
+    PHY_W(0x06, 0xe2d2),
+    PHY_W(0x06, 0xe7e2),
+    PHY_W(0x06, 0xd3e2),
+    PHY_W(0x06, 0xe02c),
+    PHY_W(0x06, 0xe3e0),
+    PHY_W(0x06, 0x2df9),
+    PHY_W(0x06, 0x5be0),
+    PHY_W(0x06, 0x1e30),
+    PHY_W(0x06, 0xe6e0),
+    PHY_W(0x06, 0x2ce7),
+    PHY_W(0x06, 0xe02d),
+    PHY_W(0x06, 0xe2e2),
+    PHY_W(0x06, 0xcce3),
+    PHY_W(0x06, 0xe2cd),
+    PHY_W(0x06, 0xf95a),
+    PHY_W(0x06, 0x0f6a),
+    PHY_W(0x06, 0x50e6),
+    PHY_W(0x06, 0xe2cc),
+    PHY_W(0x06, 0xe7e2),
+    PHY_W(0x06, 0xcde0),
+    PHY_W(0x06, 0xe03c),
+    PHY_W(0x06, 0xe1e0),
+    PHY_W(0x06, 0x3def),
+    PHY_W(0x06, 0x64fd),
+    PHY_W(0x06, 0xe0e2),
+    PHY_W(0x06, 0xcce1),
+    PHY_W(0x06, 0xe2cd),
+    PHY_W(0x06, 0x580f),
+    PHY_W(0x06, 0x5af0),
+    PHY_W(0x06, 0x1e02),
+    PHY_W(0x06, 0xe4e2),
+    PHY_W(0x06, 0xcce5),
+    PHY_W(0x06, 0xe2cd),
+    PHY_W(0x06, 0xfde0),
+    PHY_W(0x06, 0xe02c),
+    PHY_W(0x06, 0xe1e0),
+    PHY_W(0x06, 0x2d59),
+    PHY_W(0x06, 0xe05b),
+    PHY_W(0x06, 0x1f1e),
+    PHY_W(0x06, 0x13e4),
+    PHY_W(0x06, 0xe02c),
+    PHY_W(0x06, 0xe5e0),
+    PHY_W(0x06, 0x2dfd),
+    PHY_W(0x06, 0xe0e2),
+    PHY_W(0x06, 0xd2e1),
+    PHY_W(0x06, 0xe2d3),
+    PHY_W(0x06, 0x58f7),
+    PHY_W(0x06, 0x5a08),
+    PHY_W(0x06, 0x1e02),
+    PHY_W(0x06, 0xe4e2),
+    PHY_W(0x06, 0xd2e5),
+    PHY_W(0x06, 0xe2d3),
+    PHY_W(0x06, 0xef46),
+    PHY_W(0x06, 0xfefd),
+    PHY_W(0x06, 0x04f8),
+    PHY_W(0x06, 0xf9fa),
+    PHY_W(0x06, 0xef69),
+    PHY_W(0x06, 0xe0e0),
+    PHY_W(0x06, 0x22e1),
+    PHY_W(0x06, 0xe023),
+    PHY_W(0x06, 0x58c4),
+    PHY_W(0x06, 0xe18b),
+    PHY_W(0x06, 0x6e1f),
+    PHY_W(0x06, 0x109e),
+    PHY_W(0x06, 0x58e4),
+    PHY_W(0x06, 0x8b6e),
+    PHY_W(0x06, 0xad22),
+    PHY_W(0x06, 0x22ac),
+    PHY_W(0x06, 0x2755),
+    PHY_W(0x06, 0xac26),
+    PHY_W(0x06, 0x02ae),
+    PHY_W(0x06, 0x1ad1),
+    PHY_W(0x06, 0x06bf),
+    PHY_W(0x06, 0x3bba),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1d1),
+    PHY_W(0x06, 0x07bf),
+    PHY_W(0x06, 0x3bbd),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1d1),
+    PHY_W(0x06, 0x07bf),
+    PHY_W(0x06, 0x3bc0),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1ae),
+    PHY_W(0x06, 0x30d1),
+    PHY_W(0x06, 0x03bf),
+    PHY_W(0x06, 0x3bc3),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1d1),
+    PHY_W(0x06, 0x00bf),
+    PHY_W(0x06, 0x3bc6),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1d1),
+    PHY_W(0x06, 0x00bf),
+    PHY_W(0x06, 0x84e9),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1d1),
+    PHY_W(0x06, 0x0fbf),
+    PHY_W(0x06, 0x3bba),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1d1),
+    PHY_W(0x06, 0x01bf),
+    PHY_W(0x06, 0x3bbd),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1d1),
+    PHY_W(0x06, 0x01bf),
+    PHY_W(0x06, 0x3bc0),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1ef),
+    PHY_W(0x06, 0x96fe),
+    PHY_W(0x06, 0xfdfc),
+    PHY_W(0x06, 0x04d1),
+    PHY_W(0x06, 0x00bf),
+    PHY_W(0x06, 0x3bc3),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1d0),
+    PHY_W(0x06, 0x1102),
+    PHY_W(0x06, 0x2bfb),
+    PHY_W(0x06, 0x5903),
+    PHY_W(0x06, 0xef01),
+    PHY_W(0x06, 0xd100),
+    PHY_W(0x06, 0xa000),
+    PHY_W(0x06, 0x02d1),
+    PHY_W(0x06, 0x01bf),
+    PHY_W(0x06, 0x3bc6),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1d1),
+    PHY_W(0x06, 0x11ad),
+    PHY_W(0x06, 0x2002),
+    PHY_W(0x06, 0x0c11),
+    PHY_W(0x06, 0xad21),
+    PHY_W(0x06, 0x020c),
+    PHY_W(0x06, 0x12bf),
+    PHY_W(0x06, 0x84e9),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1ae),
+    PHY_W(0x06, 0xc870),
+    PHY_W(0x06, 0xe426),
+    PHY_W(0x06, 0x0284),
+    PHY_W(0x06, 0xf005),
+    PHY_W(0x06, 0xf8fa),
+    PHY_W(0x06, 0xef69),
+    PHY_W(0x06, 0xe0e2),
+    PHY_W(0x06, 0xfee1),
+    PHY_W(0x06, 0xe2ff),
+    PHY_W(0x06, 0xad2d),
+    PHY_W(0x06, 0x1ae0),
+    PHY_W(0x06, 0xe14e),
+    PHY_W(0x06, 0xe1e1),
+    PHY_W(0x06, 0x4fac),
+    PHY_W(0x06, 0x2d22),
+    PHY_W(0x06, 0xf603),
+    PHY_W(0x06, 0x0203),
+    PHY_W(0x06, 0x3bf7),
+    PHY_W(0x06, 0x03f7),
+    PHY_W(0x06, 0x06bf),
+    PHY_W(0x06, 0x8561),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0x21ae),
+    PHY_W(0x06, 0x11e0),
+    PHY_W(0x06, 0xe14e),
+    PHY_W(0x06, 0xe1e1),
+    PHY_W(0x06, 0x4fad),
+    PHY_W(0x06, 0x2d08),
+    PHY_W(0x06, 0xbf85),
+    PHY_W(0x06, 0x6c02),
+    PHY_W(0x06, 0x2d21),
+    PHY_W(0x06, 0xf606),
+    PHY_W(0x06, 0xef96),
+    PHY_W(0x06, 0xfefc),
+    PHY_W(0x06, 0x04f8),
+    PHY_W(0x06, 0xfaef),
+    PHY_W(0x06, 0x69e0),
+    PHY_W(0x06, 0xe000),
+    PHY_W(0x06, 0xe1e0),
+    PHY_W(0x06, 0x01ad),
+    PHY_W(0x06, 0x271f),
+    PHY_W(0x06, 0xd101),
+    PHY_W(0x06, 0xbf85),
+    PHY_W(0x06, 0x5e02),
+    PHY_W(0x06, 0x2dc1),
+    PHY_W(0x06, 0xe0e0),
+    PHY_W(0x06, 0x20e1),
+    PHY_W(0x06, 0xe021),
+    PHY_W(0x06, 0xad20),
+    PHY_W(0x06, 0x0ed1),
+    PHY_W(0x06, 0x00bf),
+    PHY_W(0x06, 0x855e),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0xc1bf),
+    PHY_W(0x06, 0x3b96),
+    PHY_W(0x06, 0x022d),
+    PHY_W(0x06, 0x21ef),
+    PHY_W(0x06, 0x96fe),
+    PHY_W(0x06, 0xfc04),
+    PHY_W(0x06, 0x00e2),
+    PHY_W(0x06, 0x34a7),
+    PHY_W(0x06, 0x25e5),
+    PHY_W(0x06, 0x0a1d),
+    PHY_W(0x06, 0xe50a),
+    PHY_W(0x06, 0x2ce5),
+    PHY_W(0x06, 0x0a6d),
+    PHY_W(0x06, 0xe50a),
+    PHY_W(0x06, 0x1de5),
+    PHY_W(0x06, 0x0a1c),
+    PHY_W(0x06, 0xe50a),
+    PHY_W(0x06, 0x2da7),
+    PHY_W(0x06, 0x5500),
+    PHY_W(0x05, 0x8b94),
+    PHY_W(0x06, 0x84ec),
+    PHY_SET(0x01, BIT_0),
+    PHY_W(0x00, 0x0005),
+    PHY_W(0x1f, 0x0000),
+    PHY_W(0x1f, 0x0005),
+    PHY_POLL(0x00, BIT_7, BIT_7, 20),
+    PHY_W(0x1f, 0x0007),
+    PHY_W(0x1e, 0x0023),
+    PHY_W(0x17, 0x0116),
+    PHY_W(0x1f, 0x0007),
+    PHY_W(0x1e, 0x0028),
+    PHY_W(0x15, 0x0010),
+    PHY_W(0x1f, 0x0007),
+    PHY_W(0x1e, 0x0020),
+    PHY_W(0x15, 0x0100),
+    PHY_W(0x1f, 0x0007),
+    PHY_W(0x1e, 0x0041),
+    PHY_W(0x15, 0x0802),
+    PHY_W(0x16, 0x2185),
+    PHY_W(0x1f, 0x0000),
+    PHY_END
+};
+
 static void
-rtl8101_set_phy_mcu_8105e_2(struct net_device *dev)
+rtl8101_set_phy_mcu_8105e_1(struct net_device *dev)
 {
     struct rtl8101_private *tp = netdev_priv(dev);
     
-    mdio_write(tp, 0x1F, 0x0000);
-    mdio_write(tp, 0x18, 0x0310);
-    mdio_write(tp, 0x1F, 0x0000);
+    rtl8101_run_phy_patch(tp, rtl8101_phy_mcu_8105e_1);
+}
+
+static const struct rtl8101_phy_patch_op rtl8101_phy_mcu_8105e_2[] = {
+    PHY_W(0x1f, 0x0000),
+    PHY_W(0x18, 0x0310),
+    PHY_W(0x1f, 0x0000),
+    PHY_DELAY(20),
+    PHY_W(0x1f, 0x0004),
+    PHY_W(0x1f, 0x0004),
+    PHY_W(0x19, 0x7070),
+    PHY_W(0x1c, 0x0600),
+    PHY_W(0x1d, 0x9700),
+    PHY_W(0x1d, 0x7d00),
+    PHY_W(0x1d, 0x6900),
+    PHY_W(0x1d, 0x7d00),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x4899),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x8000),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x4007),
+    PHY_W(0x1d, 0x4400),
+    PHY_W(0x1d, 0x4800),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x5310),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x6736),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x571f),
+    PHY_W(0x1d, 0x5ffb),
+    PHY_W(0x1d, 0xaa03),
+    PHY_W(0x1d, 0x5b58),
+    PHY_W(0x1d, 0x301e),
+    PHY_W(0x1d, 0x5b64),
+    PHY_W(0x1d, 0xa6fc),
+    PHY_W(0x1d, 0xdcdb),
+    PHY_W(0x1d, 0x0014),
+    PHY_W(0x1d, 0xd9a9),
+    PHY_W(0x1d, 0x0013),
+    PHY_W(0x1d, 0xd16b),
+    PHY_W(0x1d, 0x0011),
+    PHY_W(0x1d, 0xb40e),
+    PHY_W(0x1d, 0xd06b),
+    PHY_W(0x1d, 0x000c),
+    PHY_W(0x1d, 0xb206),
+    PHY_W(0x1d, 0x7c01),
+    PHY_W(0x1d, 0x5800),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x5c00),
+    PHY_W(0x1d, 0x301a),
+    PHY_W(0x1d, 0x7c01),
+    PHY_W(0x1d, 0x5801),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x5c04),
+    PHY_W(0x1d, 0x301e),
+    PHY_W(0x1d, 0x314d),
+    PHY_W(0x1d, 0x31f0),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4c20),
+    PHY_W(0x1d, 0x6004),
+    PHY_W(0x1d, 0x5310),
+    PHY_W(0x1d, 0x4833),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c08),
+    PHY_W(0x1d, 0x8300),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x6600),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0xb90c),
+    PHY_W(0x1d, 0x30d3),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4de0),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x6736),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x5310),
+    PHY_W(0x1d, 0x300b),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4c60),
+    PHY_W(0x1d, 0x6803),
+    PHY_W(0x1d, 0x6520),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0xaf03),
+    PHY_W(0x1d, 0x6015),
+    PHY_W(0x1d, 0x3059),
+    PHY_W(0x1d, 0x6017),
+    PHY_W(0x1d, 0x57e0),
+    PHY_W(0x1d, 0x580c),
+    PHY_W(0x1d, 0x588c),
+    PHY_W(0x1d, 0x7ffc),
+    PHY_W(0x1d, 0x5fa3),
+    PHY_W(0x1d, 0x4827),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c10),
+    PHY_W(0x1d, 0x8400),
+    PHY_W(0x1d, 0x7c30),
+    PHY_W(0x1d, 0x6020),
+    PHY_W(0x1d, 0x48bf),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0xad09),
+    PHY_W(0x1d, 0x7c03),
+    PHY_W(0x1d, 0x5c03),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x4400),
+    PHY_W(0x1d, 0xad2c),
+    PHY_W(0x1d, 0xd6cf),
+    PHY_W(0x1d, 0x0002),
+    PHY_W(0x1d, 0x80f4),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4c80),
+    PHY_W(0x1d, 0x7c20),
+    PHY_W(0x1d, 0x5c20),
+    PHY_W(0x1d, 0x481e),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c02),
+    PHY_W(0x1d, 0xad0a),
+    PHY_W(0x1d, 0x7c03),
+    PHY_W(0x1d, 0x5c03),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x4400),
+    PHY_W(0x1d, 0x5310),
+    PHY_W(0x1d, 0x8d02),
+    PHY_W(0x1d, 0x4401),
+    PHY_W(0x1d, 0x81f4),
+    PHY_W(0x1d, 0x3114),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4d00),
+    PHY_W(0x1d, 0x4832),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c10),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0xa4b7),
+    PHY_W(0x1d, 0xd9b3),
+    PHY_W(0x1d, 0xfffe),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4d20),
+    PHY_W(0x1d, 0x7e00),
+    PHY_W(0x1d, 0x6200),
+    PHY_W(0x1d, 0x3045),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4d40),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0x4401),
+    PHY_W(0x1d, 0x5210),
+    PHY_W(0x1d, 0x4833),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x4c08),
+    PHY_W(0x1d, 0x8300),
+    PHY_W(0x1d, 0x5f80),
+    PHY_W(0x1d, 0x55e0),
+    PHY_W(0x1d, 0xc06f),
+    PHY_W(0x1d, 0x0005),
+    PHY_W(0x1d, 0xd9b3),
+    PHY_W(0x1d, 0xfffd),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x6040),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4d60),
+    PHY_W(0x1d, 0x57e0),
+    PHY_W(0x1d, 0x4814),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x4c04),
+    PHY_W(0x1d, 0x8200),
+    PHY_W(0x1d, 0x7c03),
+    PHY_W(0x1d, 0x5c03),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0xad02),
+    PHY_W(0x1d, 0x4400),
+    PHY_W(0x1d, 0xc0e9),
+    PHY_W(0x1d, 0x0003),
+    PHY_W(0x1d, 0xadd8),
+    PHY_W(0x1d, 0x30c6),
+    PHY_W(0x1d, 0x3078),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4dc0),
+    PHY_W(0x1d, 0x6730),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0xd09d),
+    PHY_W(0x1d, 0x0002),
+    PHY_W(0x1d, 0xb4fe),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4d80),
+    PHY_W(0x1d, 0x6802),
+    PHY_W(0x1d, 0x6600),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0x486c),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x9503),
+    PHY_W(0x1d, 0x7e00),
+    PHY_W(0x1d, 0x6200),
+    PHY_W(0x1d, 0x571f),
+    PHY_W(0x1d, 0x5fbb),
+    PHY_W(0x1d, 0xaa03),
+    PHY_W(0x1d, 0x5b58),
+    PHY_W(0x1d, 0x30e9),
+    PHY_W(0x1d, 0x5b64),
+    PHY_W(0x1d, 0xcdab),
+    PHY_W(0x1d, 0xff5b),
+    PHY_W(0x1d, 0xcd8d),
+    PHY_W(0x1d, 0xff59),
+    PHY_W(0x1d, 0xd96b),
+    PHY_W(0x1d, 0xff57),
+    PHY_W(0x1d, 0xd0a0),
+    PHY_W(0x1d, 0xffdb),
+    PHY_W(0x1d, 0xcba0),
+    PHY_W(0x1d, 0x0003),
+    PHY_W(0x1d, 0x80f0),
+    PHY_W(0x1d, 0x30f6),
+    PHY_W(0x1d, 0x3109),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ce0),
+    PHY_W(0x1d, 0x7d30),
+    PHY_W(0x1d, 0x6530),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7ce0),
+    PHY_W(0x1d, 0x5400),
+    PHY_W(0x1d, 0x4832),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c08),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x6008),
+    PHY_W(0x1d, 0x8300),
+    PHY_W(0x1d, 0xb902),
+    PHY_W(0x1d, 0x30d3),
+    PHY_W(0x1d, 0x308f),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4da0),
+    PHY_W(0x1d, 0x57a0),
+    PHY_W(0x1d, 0x590c),
+    PHY_W(0x1d, 0x5fa2),
+    PHY_W(0x1d, 0xcba4),
+    PHY_W(0x1d, 0x0005),
+    PHY_W(0x1d, 0xcd8d),
+    PHY_W(0x1d, 0x0003),
+    PHY_W(0x1d, 0x80fc),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ca0),
+    PHY_W(0x1d, 0xb603),
+    PHY_W(0x1d, 0x7c10),
+    PHY_W(0x1d, 0x6010),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x541f),
+    PHY_W(0x1d, 0x7ffc),
+    PHY_W(0x1d, 0x5fb3),
+    PHY_W(0x1d, 0x9403),
+    PHY_W(0x1d, 0x7c03),
+    PHY_W(0x1d, 0x5c03),
+    PHY_W(0x1d, 0xaa05),
+    PHY_W(0x1d, 0x7c80),
+    PHY_W(0x1d, 0x5800),
+    PHY_W(0x1d, 0x5b58),
+    PHY_W(0x1d, 0x3128),
+    PHY_W(0x1d, 0x7c80),
+    PHY_W(0x1d, 0x5800),
+    PHY_W(0x1d, 0x5b64),
+    PHY_W(0x1d, 0x4827),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c10),
+    PHY_W(0x1d, 0x8400),
+    PHY_W(0x1d, 0x7c10),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0x4824),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c04),
+    PHY_W(0x1d, 0x8200),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4cc0),
+    PHY_W(0x1d, 0x7d00),
+    PHY_W(0x1d, 0x6400),
+    PHY_W(0x1d, 0x7ffc),
+    PHY_W(0x1d, 0x5fbb),
+    PHY_W(0x1d, 0x4824),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c04),
+    PHY_W(0x1d, 0x8200),
+    PHY_W(0x1d, 0x7e00),
+    PHY_W(0x1d, 0x6a00),
+    PHY_W(0x1d, 0x4824),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c04),
+    PHY_W(0x1d, 0x8200),
+    PHY_W(0x1d, 0x7e00),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x30f6),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e00),
+    PHY_W(0x1d, 0x4007),
+    PHY_W(0x1d, 0x4400),
+    PHY_W(0x1d, 0x5310),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x6736),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x570f),
+    PHY_W(0x1d, 0x5fff),
+    PHY_W(0x1d, 0xaa03),
+    PHY_W(0x1d, 0x585b),
+    PHY_W(0x1d, 0x315c),
+    PHY_W(0x1d, 0x5867),
+    PHY_W(0x1d, 0x9402),
+    PHY_W(0x1d, 0x6200),
+    PHY_W(0x1d, 0xcda3),
+    PHY_W(0x1d, 0x009d),
+    PHY_W(0x1d, 0xcd85),
+    PHY_W(0x1d, 0x009b),
+    PHY_W(0x1d, 0xd96b),
+    PHY_W(0x1d, 0x0099),
+    PHY_W(0x1d, 0x96e9),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x6736),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e20),
+    PHY_W(0x1d, 0x96e4),
+    PHY_W(0x1d, 0x8b04),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x5008),
+    PHY_W(0x1d, 0xab03),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x5000),
+    PHY_W(0x1d, 0x6801),
+    PHY_W(0x1d, 0x6776),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0xdb7c),
+    PHY_W(0x1d, 0xfff0),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7fe1),
+    PHY_W(0x1d, 0x4e40),
+    PHY_W(0x1d, 0x4837),
+    PHY_W(0x1d, 0x4418),
+    PHY_W(0x1d, 0x41c7),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e40),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x5400),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x8fc9),
+    PHY_W(0x1d, 0xd2a0),
+    PHY_W(0x1d, 0x004a),
+    PHY_W(0x1d, 0x9203),
+    PHY_W(0x1d, 0xa041),
+    PHY_W(0x1d, 0x3184),
+    PHY_W(0x1d, 0x7fe1),
+    PHY_W(0x1d, 0x4e60),
+    PHY_W(0x1d, 0x489c),
+    PHY_W(0x1d, 0x4628),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e60),
+    PHY_W(0x1d, 0x7e28),
+    PHY_W(0x1d, 0x4628),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x5400),
+    PHY_W(0x1d, 0x7c01),
+    PHY_W(0x1d, 0x5800),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x5c00),
+    PHY_W(0x1d, 0x41e8),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x8fb0),
+    PHY_W(0x1d, 0xb241),
+    PHY_W(0x1d, 0xa02a),
+    PHY_W(0x1d, 0x319d),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ea0),
+    PHY_W(0x1d, 0x7c02),
+    PHY_W(0x1d, 0x4402),
+    PHY_W(0x1d, 0x4448),
+    PHY_W(0x1d, 0x4894),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c03),
+    PHY_W(0x1d, 0x4824),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c07),
+    PHY_W(0x1d, 0x41ef),
+    PHY_W(0x1d, 0x41ff),
+    PHY_W(0x1d, 0x4891),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c07),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c17),
+    PHY_W(0x1d, 0x8400),
+    PHY_W(0x1d, 0x8ef8),
+    PHY_W(0x1d, 0x41c7),
+    PHY_W(0x1d, 0x8f95),
+    PHY_W(0x1d, 0x92d5),
+    PHY_W(0x1d, 0xa10f),
+    PHY_W(0x1d, 0xd480),
+    PHY_W(0x1d, 0x0008),
+    PHY_W(0x1d, 0xd580),
+    PHY_W(0x1d, 0xffb9),
+    PHY_W(0x1d, 0xa202),
+    PHY_W(0x1d, 0x31b8),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x4404),
+    PHY_W(0x1d, 0x31b8),
+    PHY_W(0x1d, 0xd484),
+    PHY_W(0x1d, 0xfff3),
+    PHY_W(0x1d, 0xd484),
+    PHY_W(0x1d, 0xfff1),
+    PHY_W(0x1d, 0x314d),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ee0),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x5400),
+    PHY_W(0x1d, 0x4488),
+    PHY_W(0x1d, 0x41cf),
+    PHY_W(0x1d, 0x314d),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ec0),
+    PHY_W(0x1d, 0x48f3),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c09),
+    PHY_W(0x1d, 0x4508),
+    PHY_W(0x1d, 0x41c7),
+    PHY_W(0x1d, 0x8f24),
+    PHY_W(0x1d, 0xd218),
+    PHY_W(0x1d, 0x0022),
+    PHY_W(0x1d, 0xd2a4),
+    PHY_W(0x1d, 0xff9f),
+    PHY_W(0x1d, 0x31d9),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e80),
+    PHY_W(0x1d, 0x4832),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c11),
+    PHY_W(0x1d, 0x4428),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x5440),
+    PHY_W(0x1d, 0x7c01),
+    PHY_W(0x1d, 0x5801),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x5c04),
+    PHY_W(0x1d, 0x41e8),
+    PHY_W(0x1d, 0xa4b3),
+    PHY_W(0x1d, 0x31ee),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x6736),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x570f),
+    PHY_W(0x1d, 0x5fff),
+    PHY_W(0x1d, 0xaa03),
+    PHY_W(0x1d, 0x585b),
+    PHY_W(0x1d, 0x31fa),
+    PHY_W(0x1d, 0x5867),
+    PHY_W(0x1d, 0xbcf6),
+    PHY_W(0x1d, 0x300b),
+    PHY_W(0x1d, 0x300b),
+    PHY_W(0x1d, 0x314d),
+    PHY_W(0x1f, 0x0004),
+    PHY_W(0x1c, 0x0200),
+    PHY_W(0x19, 0x7030),
+    PHY_W(0x1f, 0x0000),
+    PHY_END
+};
+
+static void
+rtl8101_set_phy_mcu_8105e_2(struct net_device *dev)
+{
+    struct rtl8101_private *tp = netdev_priv(dev);
     
-    mdelay(20);
-    
-    mdio_write(tp, 0x1f, 0x0004);
-    mdio_write(tp, 0x1f, 0x0004);
-    mdio_write(tp, 0x19, 0x7070);
-    mdio_write(tp, 0x1c, 0x0600);
-    mdio_write(tp, 0x1d, 0x9700);
-    mdio_write(tp, 0x1d, 0x7d00);
-    mdio_write(tp, 0x1d, 0x6900);
-    mdio_write(tp, 0x1d, 0x7d00);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x4899);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x8000);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x4007);
-    mdio_write(tp, 0x1d, 0x4400);
-    mdio_write(tp, 0x1d, 0x4800);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x5310);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x6736);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x571f);
-    mdio_write(tp, 0x1d, 0x5ffb);
-    mdio_write(tp, 0x1d, 0xaa03);
-    mdio_write(tp, 0x1d, 0x5b58);
-    mdio_write(tp, 0x1d, 0x301e);
-    mdio_write(tp, 0x1d, 0x5b64);
-    mdio_write(tp, 0x1d, 0xa6fc);
-    mdio_write(tp, 0x1d, 0xdcdb);
-    mdio_write(tp, 0x1d, 0x0014);
-    mdio_write(tp, 0x1d, 0xd9a9);
-    mdio_write(tp, 0x1d, 0x0013);
-    mdio_write(tp, 0x1d, 0xd16b);
-    mdio_write(tp, 0x1d, 0x0011);
-    mdio_write(tp, 0x1d, 0xb40e);
-    mdio_write(tp, 0x1d, 0xd06b);
-    mdio_write(tp, 0x1d, 0x000c);
-    mdio_write(tp, 0x1d, 0xb206);
-    mdio_write(tp, 0x1d, 0x7c01);
-    mdio_write(tp, 0x1d, 0x5800);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x5c00);
-    mdio_write(tp, 0x1d, 0x301a);
-    mdio_write(tp, 0x1d, 0x7c01);
-    mdio_write(tp, 0x1d, 0x5801);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x5c04);
-    mdio_write(tp, 0x1d, 0x301e);
-    mdio_write(tp, 0x1d, 0x314d);
-    mdio_write(tp, 0x1d, 0x31f0);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4c20);
-    mdio_write(tp, 0x1d, 0x6004);
-    mdio_write(tp, 0x1d, 0x5310);
-    mdio_write(tp, 0x1d, 0x4833);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c08);
-    mdio_write(tp, 0x1d, 0x8300);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x6600);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0xb90c);
-    mdio_write(tp, 0x1d, 0x30d3);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4de0);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x6736);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x5310);
-    mdio_write(tp, 0x1d, 0x300b);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4c60);
-    mdio_write(tp, 0x1d, 0x6803);
-    mdio_write(tp, 0x1d, 0x6520);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0xaf03);
-    mdio_write(tp, 0x1d, 0x6015);
-    mdio_write(tp, 0x1d, 0x3059);
-    mdio_write(tp, 0x1d, 0x6017);
-    mdio_write(tp, 0x1d, 0x57e0);
-    mdio_write(tp, 0x1d, 0x580c);
-    mdio_write(tp, 0x1d, 0x588c);
-    mdio_write(tp, 0x1d, 0x7ffc);
-    mdio_write(tp, 0x1d, 0x5fa3);
-    mdio_write(tp, 0x1d, 0x4827);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c10);
-    mdio_write(tp, 0x1d, 0x8400);
-    mdio_write(tp, 0x1d, 0x7c30);
-    mdio_write(tp, 0x1d, 0x6020);
-    mdio_write(tp, 0x1d, 0x48bf);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0xad09);
-    mdio_write(tp, 0x1d, 0x7c03);
-    mdio_write(tp, 0x1d, 0x5c03);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x4400);
-    mdio_write(tp, 0x1d, 0xad2c);
-    mdio_write(tp, 0x1d, 0xd6cf);
-    mdio_write(tp, 0x1d, 0x0002);
-    mdio_write(tp, 0x1d, 0x80f4);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4c80);
-    mdio_write(tp, 0x1d, 0x7c20);
-    mdio_write(tp, 0x1d, 0x5c20);
-    mdio_write(tp, 0x1d, 0x481e);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c02);
-    mdio_write(tp, 0x1d, 0xad0a);
-    mdio_write(tp, 0x1d, 0x7c03);
-    mdio_write(tp, 0x1d, 0x5c03);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x4400);
-    mdio_write(tp, 0x1d, 0x5310);
-    mdio_write(tp, 0x1d, 0x8d02);
-    mdio_write(tp, 0x1d, 0x4401);
-    mdio_write(tp, 0x1d, 0x81f4);
-    mdio_write(tp, 0x1d, 0x3114);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4d00);
-    mdio_write(tp, 0x1d, 0x4832);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c10);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0xa4b7);
-    mdio_write(tp, 0x1d, 0xd9b3);
-    mdio_write(tp, 0x1d, 0xfffe);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4d20);
-    mdio_write(tp, 0x1d, 0x7e00);
-    mdio_write(tp, 0x1d, 0x6200);
-    mdio_write(tp, 0x1d, 0x3045);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4d40);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0x4401);
-    mdio_write(tp, 0x1d, 0x5210);
-    mdio_write(tp, 0x1d, 0x4833);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x4c08);
-    mdio_write(tp, 0x1d, 0x8300);
-    mdio_write(tp, 0x1d, 0x5f80);
-    mdio_write(tp, 0x1d, 0x55e0);
-    mdio_write(tp, 0x1d, 0xc06f);
-    mdio_write(tp, 0x1d, 0x0005);
-    mdio_write(tp, 0x1d, 0xd9b3);
-    mdio_write(tp, 0x1d, 0xfffd);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x6040);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4d60);
-    mdio_write(tp, 0x1d, 0x57e0);
-    mdio_write(tp, 0x1d, 0x4814);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x4c04);
-    mdio_write(tp, 0x1d, 0x8200);
-    mdio_write(tp, 0x1d, 0x7c03);
-    mdio_write(tp, 0x1d, 0x5c03);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0xad02);
-    mdio_write(tp, 0x1d, 0x4400);
-    mdio_write(tp, 0x1d, 0xc0e9);
-    mdio_write(tp, 0x1d, 0x0003);
-    mdio_write(tp, 0x1d, 0xadd8);
-    mdio_write(tp, 0x1d, 0x30c6);
-    mdio_write(tp, 0x1d, 0x3078);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4dc0);
-    mdio_write(tp, 0x1d, 0x6730);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0xd09d);
-    mdio_write(tp, 0x1d, 0x0002);
-    mdio_write(tp, 0x1d, 0xb4fe);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4d80);
-    mdio_write(tp, 0x1d, 0x6802);
-    mdio_write(tp, 0x1d, 0x6600);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0x486c);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x9503);
-    mdio_write(tp, 0x1d, 0x7e00);
-    mdio_write(tp, 0x1d, 0x6200);
-    mdio_write(tp, 0x1d, 0x571f);
-    mdio_write(tp, 0x1d, 0x5fbb);
-    mdio_write(tp, 0x1d, 0xaa03);
-    mdio_write(tp, 0x1d, 0x5b58);
-    mdio_write(tp, 0x1d, 0x30e9);
-    mdio_write(tp, 0x1d, 0x5b64);
-    mdio_write(tp, 0x1d, 0xcdab);
-    mdio_write(tp, 0x1d, 0xff5b);
-    mdio_write(tp, 0x1d, 0xcd8d);
-    mdio_write(tp, 0x1d, 0xff59);
-    mdio_write(tp, 0x1d, 0xd96b);
-    mdio_write(tp, 0x1d, 0xff57);
-    mdio_write(tp, 0x1d, 0xd0a0);
-    mdio_write(tp, 0x1d, 0xffdb);
-    mdio_write(tp, 0x1d, 0xcba0);
-    mdio_write(tp, 0x1d, 0x0003);
-    mdio_write(tp, 0x1d, 0x80f0);
-    mdio_write(tp, 0x1d, 0x30f6);
-    mdio_write(tp, 0x1d, 0x3109);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ce0);
-    mdio_write(tp, 0x1d, 0x7d30);
-    mdio_write(tp, 0x1d, 0x6530);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7ce0);
-    mdio_write(tp, 0x1d, 0x5400);
-    mdio_write(tp, 0x1d, 0x4832);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c08);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x6008);
-    mdio_write(tp, 0x1d, 0x8300);
-    mdio_write(tp, 0x1d, 0xb902);
-    mdio_write(tp, 0x1d, 0x30d3);
-    mdio_write(tp, 0x1d, 0x308f);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4da0);
-    mdio_write(tp, 0x1d, 0x57a0);
-    mdio_write(tp, 0x1d, 0x590c);
-    mdio_write(tp, 0x1d, 0x5fa2);
-    mdio_write(tp, 0x1d, 0xcba4);
-    mdio_write(tp, 0x1d, 0x0005);
-    mdio_write(tp, 0x1d, 0xcd8d);
-    mdio_write(tp, 0x1d, 0x0003);
-    mdio_write(tp, 0x1d, 0x80fc);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ca0);
-    mdio_write(tp, 0x1d, 0xb603);
-    mdio_write(tp, 0x1d, 0x7c10);
-    mdio_write(tp, 0x1d, 0x6010);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x541f);
-    mdio_write(tp, 0x1d, 0x7ffc);
-    mdio_write(tp, 0x1d, 0x5fb3);
-    mdio_write(tp, 0x1d, 0x9403);
-    mdio_write(tp, 0x1d, 0x7c03);
-    mdio_write(tp, 0x1d, 0x5c03);
-    mdio_write(tp, 0x1d, 0xaa05);
-    mdio_write(tp, 0x1d, 0x7c80);
-    mdio_write(tp, 0x1d, 0x5800);
-    mdio_write(tp, 0x1d, 0x5b58);
-    mdio_write(tp, 0x1d, 0x3128);
-    mdio_write(tp, 0x1d, 0x7c80);
-    mdio_write(tp, 0x1d, 0x5800);
-    mdio_write(tp, 0x1d, 0x5b64);
-    mdio_write(tp, 0x1d, 0x4827);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c10);
-    mdio_write(tp, 0x1d, 0x8400);
-    mdio_write(tp, 0x1d, 0x7c10);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0x4824);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c04);
-    mdio_write(tp, 0x1d, 0x8200);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4cc0);
-    mdio_write(tp, 0x1d, 0x7d00);
-    mdio_write(tp, 0x1d, 0x6400);
-    mdio_write(tp, 0x1d, 0x7ffc);
-    mdio_write(tp, 0x1d, 0x5fbb);
-    mdio_write(tp, 0x1d, 0x4824);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c04);
-    mdio_write(tp, 0x1d, 0x8200);
-    mdio_write(tp, 0x1d, 0x7e00);
-    mdio_write(tp, 0x1d, 0x6a00);
-    mdio_write(tp, 0x1d, 0x4824);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c04);
-    mdio_write(tp, 0x1d, 0x8200);
-    mdio_write(tp, 0x1d, 0x7e00);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x30f6);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e00);
-    mdio_write(tp, 0x1d, 0x4007);
-    mdio_write(tp, 0x1d, 0x4400);
-    mdio_write(tp, 0x1d, 0x5310);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x6736);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x570f);
-    mdio_write(tp, 0x1d, 0x5fff);
-    mdio_write(tp, 0x1d, 0xaa03);
-    mdio_write(tp, 0x1d, 0x585b);
-    mdio_write(tp, 0x1d, 0x315c);
-    mdio_write(tp, 0x1d, 0x5867);
-    mdio_write(tp, 0x1d, 0x9402);
-    mdio_write(tp, 0x1d, 0x6200);
-    mdio_write(tp, 0x1d, 0xcda3);
-    mdio_write(tp, 0x1d, 0x009d);
-    mdio_write(tp, 0x1d, 0xcd85);
-    mdio_write(tp, 0x1d, 0x009b);
-    mdio_write(tp, 0x1d, 0xd96b);
-    mdio_write(tp, 0x1d, 0x0099);
-    mdio_write(tp, 0x1d, 0x96e9);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x6736);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e20);
-    mdio_write(tp, 0x1d, 0x96e4);
-    mdio_write(tp, 0x1d, 0x8b04);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x5008);
-    mdio_write(tp, 0x1d, 0xab03);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x5000);
-    mdio_write(tp, 0x1d, 0x6801);
-    mdio_write(tp, 0x1d, 0x6776);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0xdb7c);
-    mdio_write(tp, 0x1d, 0xfff0);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7fe1);
-    mdio_write(tp, 0x1d, 0x4e40);
-    mdio_write(tp, 0x1d, 0x4837);
-    mdio_write(tp, 0x1d, 0x4418);
-    mdio_write(tp, 0x1d, 0x41c7);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e40);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x5400);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x8fc9);
-    mdio_write(tp, 0x1d, 0xd2a0);
-    mdio_write(tp, 0x1d, 0x004a);
-    mdio_write(tp, 0x1d, 0x9203);
-    mdio_write(tp, 0x1d, 0xa041);
-    mdio_write(tp, 0x1d, 0x3184);
-    mdio_write(tp, 0x1d, 0x7fe1);
-    mdio_write(tp, 0x1d, 0x4e60);
-    mdio_write(tp, 0x1d, 0x489c);
-    mdio_write(tp, 0x1d, 0x4628);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e60);
-    mdio_write(tp, 0x1d, 0x7e28);
-    mdio_write(tp, 0x1d, 0x4628);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x5400);
-    mdio_write(tp, 0x1d, 0x7c01);
-    mdio_write(tp, 0x1d, 0x5800);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x5c00);
-    mdio_write(tp, 0x1d, 0x41e8);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x8fb0);
-    mdio_write(tp, 0x1d, 0xb241);
-    mdio_write(tp, 0x1d, 0xa02a);
-    mdio_write(tp, 0x1d, 0x319d);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ea0);
-    mdio_write(tp, 0x1d, 0x7c02);
-    mdio_write(tp, 0x1d, 0x4402);
-    mdio_write(tp, 0x1d, 0x4448);
-    mdio_write(tp, 0x1d, 0x4894);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c03);
-    mdio_write(tp, 0x1d, 0x4824);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c07);
-    mdio_write(tp, 0x1d, 0x41ef);
-    mdio_write(tp, 0x1d, 0x41ff);
-    mdio_write(tp, 0x1d, 0x4891);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c07);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c17);
-    mdio_write(tp, 0x1d, 0x8400);
-    mdio_write(tp, 0x1d, 0x8ef8);
-    mdio_write(tp, 0x1d, 0x41c7);
-    mdio_write(tp, 0x1d, 0x8f95);
-    mdio_write(tp, 0x1d, 0x92d5);
-    mdio_write(tp, 0x1d, 0xa10f);
-    mdio_write(tp, 0x1d, 0xd480);
-    mdio_write(tp, 0x1d, 0x0008);
-    mdio_write(tp, 0x1d, 0xd580);
-    mdio_write(tp, 0x1d, 0xffb9);
-    mdio_write(tp, 0x1d, 0xa202);
-    mdio_write(tp, 0x1d, 0x31b8);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x4404);
-    mdio_write(tp, 0x1d, 0x31b8);
-    mdio_write(tp, 0x1d, 0xd484);
-    mdio_write(tp, 0x1d, 0xfff3);
-    mdio_write(tp, 0x1d, 0xd484);
-    mdio_write(tp, 0x1d, 0xfff1);
-    mdio_write(tp, 0x1d, 0x314d);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ee0);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x5400);
-    mdio_write(tp, 0x1d, 0x4488);
-    mdio_write(tp, 0x1d, 0x41cf);
-    mdio_write(tp, 0x1d, 0x314d);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ec0);
-    mdio_write(tp, 0x1d, 0x48f3);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c09);
-    mdio_write(tp, 0x1d, 0x4508);
-    mdio_write(tp, 0x1d, 0x41c7);
-    mdio_write(tp, 0x1d, 0x8f24);
-    mdio_write(tp, 0x1d, 0xd218);
-    mdio_write(tp, 0x1d, 0x0022);
-    mdio_write(tp, 0x1d, 0xd2a4);
-    mdio_write(tp, 0x1d, 0xff9f);
-    mdio_write(tp, 0x1d, 0x31d9);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e80);
-    mdio_write(tp, 0x1d, 0x4832);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c11);
-    mdio_write(tp, 0x1d, 0x4428);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x5440);
-    mdio_write(tp, 0x1d, 0x7c01);
-    mdio_write(tp, 0x1d, 0x5801);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x5c04);
-    mdio_write(tp, 0x1d, 0x41e8);
-    mdio_write(tp, 0x1d, 0xa4b3);
-    mdio_write(tp, 0x1d, 0x31ee);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x6736);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x570f);
-    mdio_write(tp, 0x1d, 0x5fff);
-    mdio_write(tp, 0x1d, 0xaa03);
-    mdio_write(tp, 0x1d, 0x585b);
-    mdio_write(tp, 0x1d, 0x31fa);
-    mdio_write(tp, 0x1d, 0x5867);
-    mdio_write(tp, 0x1d, 0xbcf6);
-    mdio_write(tp, 0x1d, 0x300b);
-    mdio_write(tp, 0x1d, 0x300b);
-    mdio_write(tp, 0x1d, 0x314d);
-    mdio_write(tp, 0x1f, 0x0004);
-    mdio_write(tp, 0x1c, 0x0200);
-    mdio_write(tp, 0x19, 0x7030);
-    mdio_write(tp, 0x1f, 0x0000);
-}
+    rtl8101_run_phy_patch(tp, rtl8101_phy_mcu_8105e_2);
+}
+
+static const struct rtl8101_phy_patch_op rtl8101_phy_mcu_8402_1[] = {
+    PHY_W(0x1f, 0x0000),
+    PHY_W(0x18, 0x0310),
+    PHY_W(0x1f, 0x0000),
+    PHY_DELAY(20),
+    PHY_W(0x1f, 0x0004),
+    PHY_W(0x1f, 0x0004),
+    PHY_W(0x19, 0x7070),
+    PHY_W(0x1c, 0x0600),
+    PHY_W(0x1d, 0x9700),
+    PHY_W(0x1d, 0x7d00),
+    PHY_W(0x1d, 0x6900),
+    PHY_W(0x1d, 0x7d00),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x4899),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x8000),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x4007),
+    PHY_W(0x1d, 0x4400),
+    PHY_W(0x1d, 0x4800),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x5310),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x6736),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x571f),
+    PHY_W(0x1d, 0x5ffb),
+    PHY_W(0x1d, 0xaa03),
+    PHY_W(0x1d, 0x5b58),
+    PHY_W(0x1d, 0x301e),
+    PHY_W(0x1d, 0x5b64),
+    PHY_W(0x1d, 0xa6fc),
+    PHY_W(0x1d, 0xdcdb),
+    PHY_W(0x1d, 0x0015),
+    PHY_W(0x1d, 0xb915),
+    PHY_W(0x1d, 0xb511),
+    PHY_W(0x1d, 0xd16b),
+    PHY_W(0x1d, 0x000f),
+    PHY_W(0x1d, 0xb40f),
+    PHY_W(0x1d, 0xd06b),
+    PHY_W(0x1d, 0x000d),
+    PHY_W(0x1d, 0xb206),
+    PHY_W(0x1d, 0x7c01),
+    PHY_W(0x1d, 0x5800),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x5c00),
+    PHY_W(0x1d, 0x301a),
+    PHY_W(0x1d, 0x7c01),
+    PHY_W(0x1d, 0x5801),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x5c04),
+    PHY_W(0x1d, 0x301e),
+    PHY_W(0x1d, 0x3079),
+    PHY_W(0x1d, 0x30f1),
+    PHY_W(0x1d, 0x3199),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4c60),
+    PHY_W(0x1d, 0x6803),
+    PHY_W(0x1d, 0x6420),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0xaf03),
+    PHY_W(0x1d, 0x6015),
+    PHY_W(0x1d, 0x3040),
+    PHY_W(0x1d, 0x6017),
+    PHY_W(0x1d, 0x57e0),
+    PHY_W(0x1d, 0x580c),
+    PHY_W(0x1d, 0x588c),
+    PHY_W(0x1d, 0x5fa3),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x4827),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c10),
+    PHY_W(0x1d, 0x8400),
+    PHY_W(0x1d, 0x7c30),
+    PHY_W(0x1d, 0x6020),
+    PHY_W(0x1d, 0x48bf),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0xd6cf),
+    PHY_W(0x1d, 0x0002),
+    PHY_W(0x1d, 0x80fe),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4c80),
+    PHY_W(0x1d, 0x7c20),
+    PHY_W(0x1d, 0x5c20),
+    PHY_W(0x1d, 0x481e),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c02),
+    PHY_W(0x1d, 0x5310),
+    PHY_W(0x1d, 0x81ff),
+    PHY_W(0x1d, 0x30ba),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4d00),
+    PHY_W(0x1d, 0x4832),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c10),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0xa4cc),
+    PHY_W(0x1d, 0xd9b3),
+    PHY_W(0x1d, 0xfffe),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4d20),
+    PHY_W(0x1d, 0x7e00),
+    PHY_W(0x1d, 0x6200),
+    PHY_W(0x1d, 0x300b),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4dc0),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0xd09d),
+    PHY_W(0x1d, 0x0002),
+    PHY_W(0x1d, 0xb4fe),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4d80),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x6004),
+    PHY_W(0x1d, 0x5310),
+    PHY_W(0x1d, 0x6802),
+    PHY_W(0x1d, 0x6720),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0x486c),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x9503),
+    PHY_W(0x1d, 0x7e00),
+    PHY_W(0x1d, 0x6200),
+    PHY_W(0x1d, 0x571f),
+    PHY_W(0x1d, 0x5fbb),
+    PHY_W(0x1d, 0xaa03),
+    PHY_W(0x1d, 0x5b58),
+    PHY_W(0x1d, 0x3092),
+    PHY_W(0x1d, 0x5b64),
+    PHY_W(0x1d, 0xcdab),
+    PHY_W(0x1d, 0xff78),
+    PHY_W(0x1d, 0xcd8d),
+    PHY_W(0x1d, 0xff76),
+    PHY_W(0x1d, 0xd96b),
+    PHY_W(0x1d, 0xff74),
+    PHY_W(0x1d, 0xd0a0),
+    PHY_W(0x1d, 0xffd9),
+    PHY_W(0x1d, 0xcba0),
+    PHY_W(0x1d, 0x0003),
+    PHY_W(0x1d, 0x80f0),
+    PHY_W(0x1d, 0x309f),
+    PHY_W(0x1d, 0x30ac),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ce0),
+    PHY_W(0x1d, 0x4832),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c08),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x6008),
+    PHY_W(0x1d, 0x8300),
+    PHY_W(0x1d, 0xb902),
+    PHY_W(0x1d, 0x3079),
+    PHY_W(0x1d, 0x3061),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4da0),
+    PHY_W(0x1d, 0x6400),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x57a0),
+    PHY_W(0x1d, 0x590c),
+    PHY_W(0x1d, 0x5fa3),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0xcba4),
+    PHY_W(0x1d, 0x0004),
+    PHY_W(0x1d, 0xcd8d),
+    PHY_W(0x1d, 0x0002),
+    PHY_W(0x1d, 0x80fc),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ca0),
+    PHY_W(0x1d, 0xb603),
+    PHY_W(0x1d, 0x7c10),
+    PHY_W(0x1d, 0x6010),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x541f),
+    PHY_W(0x1d, 0x5fb3),
+    PHY_W(0x1d, 0xaa05),
+    PHY_W(0x1d, 0x7c80),
+    PHY_W(0x1d, 0x5800),
+    PHY_W(0x1d, 0x5b58),
+    PHY_W(0x1d, 0x30ca),
+    PHY_W(0x1d, 0x7c80),
+    PHY_W(0x1d, 0x5800),
+    PHY_W(0x1d, 0x5b64),
+    PHY_W(0x1d, 0x4824),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c04),
+    PHY_W(0x1d, 0x8200),
+    PHY_W(0x1d, 0x4827),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c10),
+    PHY_W(0x1d, 0x8400),
+    PHY_W(0x1d, 0x7c10),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4cc0),
+    PHY_W(0x1d, 0x5fbb),
+    PHY_W(0x1d, 0x4824),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c04),
+    PHY_W(0x1d, 0x8200),
+    PHY_W(0x1d, 0x7ce0),
+    PHY_W(0x1d, 0x5400),
+    PHY_W(0x1d, 0x6720),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7e00),
+    PHY_W(0x1d, 0x6a00),
+    PHY_W(0x1d, 0x4824),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c04),
+    PHY_W(0x1d, 0x8200),
+    PHY_W(0x1d, 0x7e00),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x309f),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e00),
+    PHY_W(0x1d, 0x4007),
+    PHY_W(0x1d, 0x4400),
+    PHY_W(0x1d, 0x5310),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x6736),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x570f),
+    PHY_W(0x1d, 0x5fff),
+    PHY_W(0x1d, 0xaa03),
+    PHY_W(0x1d, 0x585b),
+    PHY_W(0x1d, 0x3100),
+    PHY_W(0x1d, 0x5867),
+    PHY_W(0x1d, 0x9403),
+    PHY_W(0x1d, 0x7e00),
+    PHY_W(0x1d, 0x6200),
+    PHY_W(0x1d, 0xcda3),
+    PHY_W(0x1d, 0x002d),
+    PHY_W(0x1d, 0xcd85),
+    PHY_W(0x1d, 0x002b),
+    PHY_W(0x1d, 0xd96b),
+    PHY_W(0x1d, 0x0029),
+    PHY_W(0x1d, 0x9629),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x6736),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x9624),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e20),
+    PHY_W(0x1d, 0x8b04),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x5008),
+    PHY_W(0x1d, 0xab03),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x5000),
+    PHY_W(0x1d, 0x6801),
+    PHY_W(0x1d, 0x6776),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0xdb7c),
+    PHY_W(0x1d, 0xffee),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7fe1),
+    PHY_W(0x1d, 0x4e40),
+    PHY_W(0x1d, 0x4837),
+    PHY_W(0x1d, 0x4418),
+    PHY_W(0x1d, 0x41c7),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e40),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x5400),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x8f07),
+    PHY_W(0x1d, 0xd2a0),
+    PHY_W(0x1d, 0x004c),
+    PHY_W(0x1d, 0x9205),
+    PHY_W(0x1d, 0xa043),
+    PHY_W(0x1d, 0x312b),
+    PHY_W(0x1d, 0x300b),
+    PHY_W(0x1d, 0x30f1),
+    PHY_W(0x1d, 0x7fe1),
+    PHY_W(0x1d, 0x4e60),
+    PHY_W(0x1d, 0x489c),
+    PHY_W(0x1d, 0x4628),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e60),
+    PHY_W(0x1d, 0x7e28),
+    PHY_W(0x1d, 0x4628),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x5400),
+    PHY_W(0x1d, 0x7c01),
+    PHY_W(0x1d, 0x5800),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x5c00),
+    PHY_W(0x1d, 0x41e8),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x8fec),
+    PHY_W(0x1d, 0xb241),
+    PHY_W(0x1d, 0xa02a),
+    PHY_W(0x1d, 0x3146),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ea0),
+    PHY_W(0x1d, 0x7c02),
+    PHY_W(0x1d, 0x4402),
+    PHY_W(0x1d, 0x4448),
+    PHY_W(0x1d, 0x4894),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c03),
+    PHY_W(0x1d, 0x4824),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c07),
+    PHY_W(0x1d, 0x41ef),
+    PHY_W(0x1d, 0x41ff),
+    PHY_W(0x1d, 0x4891),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c07),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c17),
+    PHY_W(0x1d, 0x8400),
+    PHY_W(0x1d, 0x8ef8),
+    PHY_W(0x1d, 0x41c7),
+    PHY_W(0x1d, 0x8fd1),
+    PHY_W(0x1d, 0x92d5),
+    PHY_W(0x1d, 0xa10f),
+    PHY_W(0x1d, 0xd480),
+    PHY_W(0x1d, 0x0008),
+    PHY_W(0x1d, 0xd580),
+    PHY_W(0x1d, 0xffb7),
+    PHY_W(0x1d, 0xa202),
+    PHY_W(0x1d, 0x3161),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x4404),
+    PHY_W(0x1d, 0x3161),
+    PHY_W(0x1d, 0xd484),
+    PHY_W(0x1d, 0xfff3),
+    PHY_W(0x1d, 0xd484),
+    PHY_W(0x1d, 0xfff1),
+    PHY_W(0x1d, 0x30f1),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ee0),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x5400),
+    PHY_W(0x1d, 0x4488),
+    PHY_W(0x1d, 0x41cf),
+    PHY_W(0x1d, 0x30f1),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ec0),
+    PHY_W(0x1d, 0x48f3),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c09),
+    PHY_W(0x1d, 0x4508),
+    PHY_W(0x1d, 0x41c7),
+    PHY_W(0x1d, 0x8fb0),
+    PHY_W(0x1d, 0xd218),
+    PHY_W(0x1d, 0xffae),
+    PHY_W(0x1d, 0xd2a4),
+    PHY_W(0x1d, 0xff9d),
+    PHY_W(0x1d, 0x3182),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e80),
+    PHY_W(0x1d, 0x4832),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c11),
+    PHY_W(0x1d, 0x4428),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x5440),
+    PHY_W(0x1d, 0x7c01),
+    PHY_W(0x1d, 0x5801),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x5c04),
+    PHY_W(0x1d, 0x41e8),
+    PHY_W(0x1d, 0xa4b3),
+    PHY_W(0x1d, 0x3197),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4f20),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x6736),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x570f),
+    PHY_W(0x1d, 0x5fff),
+    PHY_W(0x1d, 0xaa03),
+    PHY_W(0x1d, 0x585b),
+    PHY_W(0x1d, 0x31a5),
+    PHY_W(0x1d, 0x5867),
+    PHY_W(0x1d, 0xbcf4),
+    PHY_W(0x1d, 0x300b),
+    PHY_W(0x1f, 0x0004),
+    PHY_W(0x1c, 0x0200),
+    PHY_W(0x19, 0x7030),
+    PHY_W(0x1f, 0x0000),
+    PHY_END
+};
 
 static void
 rtl8101_set_phy_mcu_8402_1(struct net_device *dev)
 {
     struct rtl8101_private *tp = netdev_priv(dev);
     
-    mdio_write(tp, 0x1F, 0x0000);
-    mdio_write(tp, 0x18, 0x0310);
-    mdio_write(tp, 0x1F, 0x0000);
-    
-    mdelay(20);
-    
-    mdio_write(tp, 0x1f, 0x0004);
-    mdio_write(tp, 0x1f, 0x0004);
-    mdio_write(tp, 0x19, 0x7070);
-    mdio_write(tp, 0x1c, 0x0600);
-    mdio_write(tp, 0x1d, 0x9700);
-    mdio_write(tp, 0x1d, 0x7d00);
-    mdio_write(tp, 0x1d, 0x6900);
-    mdio_write(tp, 0x1d, 0x7d00);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x4899);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x8000);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x4007);
-    mdio_write(tp, 0x1d, 0x4400);
-    mdio_write(tp, 0x1d, 0x4800);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x5310);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x6736);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x571f);
-    mdio_write(tp, 0x1d, 0x5ffb);
-    mdio_write(tp, 0x1d, 0xaa03);
-    mdio_write(tp, 0x1d, 0x5b58);
-    mdio_write(tp, 0x1d, 0x301e);
-    mdio_write(tp, 0x1d, 0x5b64);
-    mdio_write(tp, 0x1d, 0xa6fc);
-    mdio_write(tp, 0x1d, 0xdcdb);
-    mdio_write(tp, 0x1d, 0x0015);
-    mdio_write(tp, 0x1d, 0xb915);
-    mdio_write(tp, 0x1d, 0xb511);
-    mdio_write(tp, 0x1d, 0xd16b);
-    mdio_write(tp, 0x1d, 0x000f);
-    mdio_write(tp, 0x1d, 0xb40f);
-    mdio_write(tp, 0x1d, 0xd06b);
-    mdio_write(tp, 0x1d, 0x000d);
-    mdio_write(tp, 0x1d, 0xb206);
-    mdio_write(tp, 0x1d, 0x7c01);
-    mdio_write(tp, 0x1d, 0x5800);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x5c00);
-    mdio_write(tp, 0x1d, 0x301a);
-    mdio_write(tp, 0x1d, 0x7c01);
-    mdio_write(tp, 0x1d, 0x5801);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x5c04);
-    mdio_write(tp, 0x1d, 0x301e);
-    mdio_write(tp, 0x1d, 0x3079);
-    mdio_write(tp, 0x1d, 0x30f1);
-    mdio_write(tp, 0x1d, 0x3199);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4c60);
-    mdio_write(tp, 0x1d, 0x6803);
-    mdio_write(tp, 0x1d, 0x6420);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0xaf03);
-    mdio_write(tp, 0x1d, 0x6015);
-    mdio_write(tp, 0x1d, 0x3040);
-    mdio_write(tp, 0x1d, 0x6017);
-    mdio_write(tp, 0x1d, 0x57e0);
-    mdio_write(tp, 0x1d, 0x580c);
-    mdio_write(tp, 0x1d, 0x588c);
-    mdio_write(tp, 0x1d, 0x5fa3);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x4827);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c10);
-    mdio_write(tp, 0x1d, 0x8400);
-    mdio_write(tp, 0x1d, 0x7c30);
-    mdio_write(tp, 0x1d, 0x6020);
-    mdio_write(tp, 0x1d, 0x48bf);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0xd6cf);
-    mdio_write(tp, 0x1d, 0x0002);
-    mdio_write(tp, 0x1d, 0x80fe);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4c80);
-    mdio_write(tp, 0x1d, 0x7c20);
-    mdio_write(tp, 0x1d, 0x5c20);
-    mdio_write(tp, 0x1d, 0x481e);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c02);
-    mdio_write(tp, 0x1d, 0x5310);
-    mdio_write(tp, 0x1d, 0x81ff);
-    mdio_write(tp, 0x1d, 0x30ba);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4d00);
-    mdio_write(tp, 0x1d, 0x4832);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c10);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0xa4cc);
-    mdio_write(tp, 0x1d, 0xd9b3);
-    mdio_write(tp, 0x1d, 0xfffe);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4d20);
-    mdio_write(tp, 0x1d, 0x7e00);
-    mdio_write(tp, 0x1d, 0x6200);
-    mdio_write(tp, 0x1d, 0x300b);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4dc0);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0xd09d);
-    mdio_write(tp, 0x1d, 0x0002);
-    mdio_write(tp, 0x1d, 0xb4fe);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4d80);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x6004);
-    mdio_write(tp, 0x1d, 0x5310);
-    mdio_write(tp, 0x1d, 0x6802);
-    mdio_write(tp, 0x1d, 0x6720);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0x486c);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x9503);
-    mdio_write(tp, 0x1d, 0x7e00);
-    mdio_write(tp, 0x1d, 0x6200);
-    mdio_write(tp, 0x1d, 0x571f);
-    mdio_write(tp, 0x1d, 0x5fbb);
-    mdio_write(tp, 0x1d, 0xaa03);
-    mdio_write(tp, 0x1d, 0x5b58);
-    mdio_write(tp, 0x1d, 0x3092);
-    mdio_write(tp, 0x1d, 0x5b64);
-    mdio_write(tp, 0x1d, 0xcdab);
-    mdio_write(tp, 0x1d, 0xff78);
-    mdio_write(tp, 0x1d, 0xcd8d);
-    mdio_write(tp, 0x1d, 0xff76);
-    mdio_write(tp, 0x1d, 0xd96b);
-    mdio_write(tp, 0x1d, 0xff74);
-    mdio_write(tp, 0x1d, 0xd0a0);
-    mdio_write(tp, 0x1d, 0xffd9);
-    mdio_write(tp, 0x1d, 0xcba0);
-    mdio_write(tp, 0x1d, 0x0003);
-    mdio_write(tp, 0x1d, 0x80f0);
-    mdio_write(tp, 0x1d, 0x309f);
-    mdio_write(tp, 0x1d, 0x30ac);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ce0);
-    mdio_write(tp, 0x1d, 0x4832);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c08);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x6008);
-    mdio_write(tp, 0x1d, 0x8300);
-    mdio_write(tp, 0x1d, 0xb902);
-    mdio_write(tp, 0x1d, 0x3079);
-    mdio_write(tp, 0x1d, 0x3061);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4da0);
-    mdio_write(tp, 0x1d, 0x6400);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x57a0);
-    mdio_write(tp, 0x1d, 0x590c);
-    mdio_write(tp, 0x1d, 0x5fa3);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0xcba4);
-    mdio_write(tp, 0x1d, 0x0004);
-    mdio_write(tp, 0x1d, 0xcd8d);
-    mdio_write(tp, 0x1d, 0x0002);
-    mdio_write(tp, 0x1d, 0x80fc);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ca0);
-    mdio_write(tp, 0x1d, 0xb603);
-    mdio_write(tp, 0x1d, 0x7c10);
-    mdio_write(tp, 0x1d, 0x6010);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x541f);
-    mdio_write(tp, 0x1d, 0x5fb3);
-    mdio_write(tp, 0x1d, 0xaa05);
-    mdio_write(tp, 0x1d, 0x7c80);
-    mdio_write(tp, 0x1d, 0x5800);
-    mdio_write(tp, 0x1d, 0x5b58);
-    mdio_write(tp, 0x1d, 0x30ca);
-    mdio_write(tp, 0x1d, 0x7c80);
-    mdio_write(tp, 0x1d, 0x5800);
-    mdio_write(tp, 0x1d, 0x5b64);
-    mdio_write(tp, 0x1d, 0x4824);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c04);
-    mdio_write(tp, 0x1d, 0x8200);
-    mdio_write(tp, 0x1d, 0x4827);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c10);
-    mdio_write(tp, 0x1d, 0x8400);
-    mdio_write(tp, 0x1d, 0x7c10);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4cc0);
-    mdio_write(tp, 0x1d, 0x5fbb);
-    mdio_write(tp, 0x1d, 0x4824);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c04);
-    mdio_write(tp, 0x1d, 0x8200);
-    mdio_write(tp, 0x1d, 0x7ce0);
-    mdio_write(tp, 0x1d, 0x5400);
-    mdio_write(tp, 0x1d, 0x6720);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7e00);
-    mdio_write(tp, 0x1d, 0x6a00);
-    mdio_write(tp, 0x1d, 0x4824);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c04);
-    mdio_write(tp, 0x1d, 0x8200);
-    mdio_write(tp, 0x1d, 0x7e00);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x309f);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e00);
-    mdio_write(tp, 0x1d, 0x4007);
-    mdio_write(tp, 0x1d, 0x4400);
-    mdio_write(tp, 0x1d, 0x5310);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x6736);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x570f);
-    mdio_write(tp, 0x1d, 0x5fff);
-    mdio_write(tp, 0x1d, 0xaa03);
-    mdio_write(tp, 0x1d, 0x585b);
-    mdio_write(tp, 0x1d, 0x3100);
-    mdio_write(tp, 0x1d, 0x5867);
-    mdio_write(tp, 0x1d, 0x9403);
-    mdio_write(tp, 0x1d, 0x7e00);
-    mdio_write(tp, 0x1d, 0x6200);
-    mdio_write(tp, 0x1d, 0xcda3);
-    mdio_write(tp, 0x1d, 0x002d);
-    mdio_write(tp, 0x1d, 0xcd85);
-    mdio_write(tp, 0x1d, 0x002b);
-    mdio_write(tp, 0x1d, 0xd96b);
-    mdio_write(tp, 0x1d, 0x0029);
-    mdio_write(tp, 0x1d, 0x9629);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x6736);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x9624);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e20);
-    mdio_write(tp, 0x1d, 0x8b04);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x5008);
-    mdio_write(tp, 0x1d, 0xab03);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x5000);
-    mdio_write(tp, 0x1d, 0x6801);
-    mdio_write(tp, 0x1d, 0x6776);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0xdb7c);
-    mdio_write(tp, 0x1d, 0xffee);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7fe1);
-    mdio_write(tp, 0x1d, 0x4e40);
-    mdio_write(tp, 0x1d, 0x4837);
-    mdio_write(tp, 0x1d, 0x4418);
-    mdio_write(tp, 0x1d, 0x41c7);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e40);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x5400);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x8f07);
-    mdio_write(tp, 0x1d, 0xd2a0);
-    mdio_write(tp, 0x1d, 0x004c);
-    mdio_write(tp, 0x1d, 0x9205);
-    mdio_write(tp, 0x1d, 0xa043);
-    mdio_write(tp, 0x1d, 0x312b);
-    mdio_write(tp, 0x1d, 0x300b);
-    mdio_write(tp, 0x1d, 0x30f1);
-    mdio_write(tp, 0x1d, 0x7fe1);
-    mdio_write(tp, 0x1d, 0x4e60);
-    mdio_write(tp, 0x1d, 0x489c);
-    mdio_write(tp, 0x1d, 0x4628);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e60);
-    mdio_write(tp, 0x1d, 0x7e28);
-    mdio_write(tp, 0x1d, 0x4628);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x5400);
-    mdio_write(tp, 0x1d, 0x7c01);
-    mdio_write(tp, 0x1d, 0x5800);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x5c00);
-    mdio_write(tp, 0x1d, 0x41e8);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x8fec);
-    mdio_write(tp, 0x1d, 0xb241);
-    mdio_write(tp, 0x1d, 0xa02a);
-    mdio_write(tp, 0x1d, 0x3146);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ea0);
-    mdio_write(tp, 0x1d, 0x7c02);
-    mdio_write(tp, 0x1d, 0x4402);
-    mdio_write(tp, 0x1d, 0x4448);
-    mdio_write(tp, 0x1d, 0x4894);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c03);
-    mdio_write(tp, 0x1d, 0x4824);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c07);
-    mdio_write(tp, 0x1d, 0x41ef);
-    mdio_write(tp, 0x1d, 0x41ff);
-    mdio_write(tp, 0x1d, 0x4891);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c07);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c17);
-    mdio_write(tp, 0x1d, 0x8400);
-    mdio_write(tp, 0x1d, 0x8ef8);
-    mdio_write(tp, 0x1d, 0x41c7);
-    mdio_write(tp, 0x1d, 0x8fd1);
-    mdio_write(tp, 0x1d, 0x92d5);
-    mdio_write(tp, 0x1d, 0xa10f);
-    mdio_write(tp, 0x1d, 0xd480);
-    mdio_write(tp, 0x1d, 0x0008);
-    mdio_write(tp, 0x1d, 0xd580);
-    mdio_write(tp, 0x1d, 0xffb7);
-    mdio_write(tp, 0x1d, 0xa202);
-    mdio_write(tp, 0x1d, 0x3161);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x4404);
-    mdio_write(tp, 0x1d, 0x3161);
-    mdio_write(tp, 0x1d, 0xd484);
-    mdio_write(tp, 0x1d, 0xfff3);
-    mdio_write(tp, 0x1d, 0xd484);
-    mdio_write(tp, 0x1d, 0xfff1);
-    mdio_write(tp, 0x1d, 0x30f1);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ee0);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x5400);
-    mdio_write(tp, 0x1d, 0x4488);
-    mdio_write(tp, 0x1d, 0x41cf);
-    mdio_write(tp, 0x1d, 0x30f1);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ec0);
-    mdio_write(tp, 0x1d, 0x48f3);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c09);
-    mdio_write(tp, 0x1d, 0x4508);
-    mdio_write(tp, 0x1d, 0x41c7);
-    mdio_write(tp, 0x1d, 0x8fb0);
-    mdio_write(tp, 0x1d, 0xd218);
-    mdio_write(tp, 0x1d, 0xffae);
-    mdio_write(tp, 0x1d, 0xd2a4);
-    mdio_write(tp, 0x1d, 0xff9d);
-    mdio_write(tp, 0x1d, 0x3182);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e80);
-    mdio_write(tp, 0x1d, 0x4832);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c11);
-    mdio_write(tp, 0x1d, 0x4428);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x5440);
-    mdio_write(tp, 0x1d, 0x7c01);
-    mdio_write(tp, 0x1d, 0x5801);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x5c04);
-    mdio_write(tp, 0x1d, 0x41e8);
-    mdio_write(tp, 0x1d, 0xa4b3);
-    mdio_write(tp, 0x1d, 0x3197);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4f20);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x6736);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x570f);
-    mdio_write(tp, 0x1d, 0x5fff);
-    mdio_write(tp, 0x1d, 0xaa03);
-    mdio_write(tp, 0x1d, 0x585b);
-    mdio_write(tp, 0x1d, 0x31a5);
-    mdio_write(tp, 0x1d, 0x5867);
-    mdio_write(tp, 0x1d, 0xbcf4);
-    mdio_write(tp, 0x1d, 0x300b);
-    mdio_write(tp, 0x1f, 0x0004);
-    mdio_write(tp, 0x1c, 0x0200);
-    mdio_write(tp, 0x19, 0x7030);
-    mdio_write(tp, 0x1f, 0x0000);
-}
+    rtl8101_run_phy_patch(tp, rtl8101_phy_mcu_8402_1);
+}
+
+static const struct rtl8101_phy_patch_op rtl8101_phy_mcu_8106e_2[] = {
+    PHY_W(0x1f, 0x0000),
+    PHY_W(0x18, 0x0310),
+    PHY_DELAY(20),
+    PHY_W(0x1f, 0x0004),
+    PHY_W(0x1f, 0x0004),
+    PHY_W(0x19, 0x7070),
+    PHY_W(0x1c, 0x0600),
+    PHY_W(0x1d, 0x9700),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x4007),
+    PHY_W(0x1d, 0x4400),
+    PHY_W(0x1d, 0x4800),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x5310),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x673e),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x571f),
+    PHY_W(0x1d, 0x5ffb),
+    PHY_W(0x1d, 0xaa04),
+    PHY_W(0x1d, 0x5b58),
+    PHY_W(0x1d, 0x6100),
+    PHY_W(0x1d, 0x3016),
+    PHY_W(0x1d, 0x5b64),
+    PHY_W(0x1d, 0x6080),
+    PHY_W(0x1d, 0xa6fa),
+    PHY_W(0x1d, 0xdcdb),
+    PHY_W(0x1d, 0x0015),
+    PHY_W(0x1d, 0xb915),
+    PHY_W(0x1d, 0xb511),
+    PHY_W(0x1d, 0xd16b),
+    PHY_W(0x1d, 0x000f),
+    PHY_W(0x1d, 0xb40f),
+    PHY_W(0x1d, 0xd06b),
+    PHY_W(0x1d, 0x000d),
+    PHY_W(0x1d, 0xb206),
+    PHY_W(0x1d, 0x7c01),
+    PHY_W(0x1d, 0x5800),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x5c00),
+    PHY_W(0x1d, 0x3010),
+    PHY_W(0x1d, 0x7c01),
+    PHY_W(0x1d, 0x5801),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x5c04),
+    PHY_W(0x1d, 0x3016),
+    PHY_W(0x1d, 0x307e),
+    PHY_W(0x1d, 0x30f4),
+    PHY_W(0x1d, 0x319f),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4c60),
+    PHY_W(0x1d, 0x6803),
+    PHY_W(0x1d, 0x7d00),
+    PHY_W(0x1d, 0x6900),
+    PHY_W(0x1d, 0x6520),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0xaf03),
+    PHY_W(0x1d, 0x6115),
+    PHY_W(0x1d, 0x303a),
+    PHY_W(0x1d, 0x6097),
+    PHY_W(0x1d, 0x57e0),
+    PHY_W(0x1d, 0x580c),
+    PHY_W(0x1d, 0x588c),
+    PHY_W(0x1d, 0x5f80),
+    PHY_W(0x1d, 0x4827),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c10),
+    PHY_W(0x1d, 0x8400),
+    PHY_W(0x1d, 0x7c30),
+    PHY_W(0x1d, 0x6020),
+    PHY_W(0x1d, 0x48bf),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0xb802),
+    PHY_W(0x1d, 0x3053),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x6808),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7c10),
+    PHY_W(0x1d, 0x6810),
+    PHY_W(0x1d, 0xd6cf),
+    PHY_W(0x1d, 0x0002),
+    PHY_W(0x1d, 0x80fe),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4c80),
+    PHY_W(0x1d, 0x7c10),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7c23),
+    PHY_W(0x1d, 0x5c23),
+    PHY_W(0x1d, 0x481e),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c02),
+    PHY_W(0x1d, 0x5310),
+    PHY_W(0x1d, 0x81ff),
+    PHY_W(0x1d, 0x30c1),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4d00),
+    PHY_W(0x1d, 0x4832),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c10),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0xa4bd),
+    PHY_W(0x1d, 0xd9b3),
+    PHY_W(0x1d, 0x00fe),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4d20),
+    PHY_W(0x1d, 0x7e00),
+    PHY_W(0x1d, 0x6200),
+    PHY_W(0x1d, 0x3001),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4dc0),
+    PHY_W(0x1d, 0xd09d),
+    PHY_W(0x1d, 0x0002),
+    PHY_W(0x1d, 0xb4fe),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4d80),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x6004),
+    PHY_W(0x1d, 0x6802),
+    PHY_W(0x1d, 0x6728),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0x486c),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x9503),
+    PHY_W(0x1d, 0x7e00),
+    PHY_W(0x1d, 0x6200),
+    PHY_W(0x1d, 0x571f),
+    PHY_W(0x1d, 0x5fbb),
+    PHY_W(0x1d, 0xaa05),
+    PHY_W(0x1d, 0x5b58),
+    PHY_W(0x1d, 0x7d80),
+    PHY_W(0x1d, 0x6100),
+    PHY_W(0x1d, 0x309a),
+    PHY_W(0x1d, 0x5b64),
+    PHY_W(0x1d, 0x7d80),
+    PHY_W(0x1d, 0x6080),
+    PHY_W(0x1d, 0xcdab),
+    PHY_W(0x1d, 0x0058),
+    PHY_W(0x1d, 0xcd8d),
+    PHY_W(0x1d, 0x0056),
+    PHY_W(0x1d, 0xd96b),
+    PHY_W(0x1d, 0x0054),
+    PHY_W(0x1d, 0xd0a0),
+    PHY_W(0x1d, 0x00d8),
+    PHY_W(0x1d, 0xcba0),
+    PHY_W(0x1d, 0x0003),
+    PHY_W(0x1d, 0x80ec),
+    PHY_W(0x1d, 0x30a7),
+    PHY_W(0x1d, 0x30b4),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ce0),
+    PHY_W(0x1d, 0x4832),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c08),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x6008),
+    PHY_W(0x1d, 0x8300),
+    PHY_W(0x1d, 0xb902),
+    PHY_W(0x1d, 0x307e),
+    PHY_W(0x1d, 0x3068),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4da0),
+    PHY_W(0x1d, 0x6628),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x56a0),
+    PHY_W(0x1d, 0x590c),
+    PHY_W(0x1d, 0x5fa0),
+    PHY_W(0x1d, 0xcba4),
+    PHY_W(0x1d, 0x0004),
+    PHY_W(0x1d, 0xcd8d),
+    PHY_W(0x1d, 0x0002),
+    PHY_W(0x1d, 0x80fc),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ca0),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x6408),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7d00),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0xb603),
+    PHY_W(0x1d, 0x7c10),
+    PHY_W(0x1d, 0x6010),
+    PHY_W(0x1d, 0x7d1f),
+    PHY_W(0x1d, 0x551f),
+    PHY_W(0x1d, 0x5fb3),
+    PHY_W(0x1d, 0xaa05),
+    PHY_W(0x1d, 0x7c80),
+    PHY_W(0x1d, 0x5800),
+    PHY_W(0x1d, 0x5b58),
+    PHY_W(0x1d, 0x30d7),
+    PHY_W(0x1d, 0x7c80),
+    PHY_W(0x1d, 0x5800),
+    PHY_W(0x1d, 0x5b64),
+    PHY_W(0x1d, 0x4827),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c10),
+    PHY_W(0x1d, 0x8400),
+    PHY_W(0x1d, 0x7c10),
+    PHY_W(0x1d, 0x6000),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4cc0),
+    PHY_W(0x1d, 0x7d00),
+    PHY_W(0x1d, 0x6400),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x5fbb),
+    PHY_W(0x1d, 0x4824),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c00),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c04),
+    PHY_W(0x1d, 0x8200),
+    PHY_W(0x1d, 0x7ce0),
+    PHY_W(0x1d, 0x5400),
+    PHY_W(0x1d, 0x7d00),
+    PHY_W(0x1d, 0x6500),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x30a7),
+    PHY_W(0x1d, 0x3001),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e00),
+    PHY_W(0x1d, 0x4007),
+    PHY_W(0x1d, 0x4400),
+    PHY_W(0x1d, 0x5310),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x673e),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x570f),
+    PHY_W(0x1d, 0x5fff),
+    PHY_W(0x1d, 0xaa05),
+    PHY_W(0x1d, 0x585b),
+    PHY_W(0x1d, 0x7d80),
+    PHY_W(0x1d, 0x6100),
+    PHY_W(0x1d, 0x3107),
+    PHY_W(0x1d, 0x5867),
+    PHY_W(0x1d, 0x7d80),
+    PHY_W(0x1d, 0x6080),
+    PHY_W(0x1d, 0x9403),
+    PHY_W(0x1d, 0x7e00),
+    PHY_W(0x1d, 0x6200),
+    PHY_W(0x1d, 0xcda3),
+    PHY_W(0x1d, 0x00e8),
+    PHY_W(0x1d, 0xcd85),
+    PHY_W(0x1d, 0x00e6),
+    PHY_W(0x1d, 0xd96b),
+    PHY_W(0x1d, 0x00e4),
+    PHY_W(0x1d, 0x96e4),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x673e),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e20),
+    PHY_W(0x1d, 0x96dd),
+    PHY_W(0x1d, 0x8b04),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x5008),
+    PHY_W(0x1d, 0xab03),
+    PHY_W(0x1d, 0x7c08),
+    PHY_W(0x1d, 0x5000),
+    PHY_W(0x1d, 0x6801),
+    PHY_W(0x1d, 0x677e),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0xdb7c),
+    PHY_W(0x1d, 0x00ee),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x7fe1),
+    PHY_W(0x1d, 0x4e40),
+    PHY_W(0x1d, 0x4837),
+    PHY_W(0x1d, 0x4418),
+    PHY_W(0x1d, 0x41c7),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e40),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x5400),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x8fc2),
+    PHY_W(0x1d, 0xd2a0),
+    PHY_W(0x1d, 0x004b),
+    PHY_W(0x1d, 0x9204),
+    PHY_W(0x1d, 0xa042),
+    PHY_W(0x1d, 0x3132),
+    PHY_W(0x1d, 0x30f4),
+    PHY_W(0x1d, 0x7fe1),
+    PHY_W(0x1d, 0x4e60),
+    PHY_W(0x1d, 0x489c),
+    PHY_W(0x1d, 0x4628),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e60),
+    PHY_W(0x1d, 0x7e28),
+    PHY_W(0x1d, 0x4628),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x5400),
+    PHY_W(0x1d, 0x7c01),
+    PHY_W(0x1d, 0x5800),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x5c00),
+    PHY_W(0x1d, 0x41e8),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x8fa8),
+    PHY_W(0x1d, 0xb241),
+    PHY_W(0x1d, 0xa02a),
+    PHY_W(0x1d, 0x314c),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ea0),
+    PHY_W(0x1d, 0x7c02),
+    PHY_W(0x1d, 0x4402),
+    PHY_W(0x1d, 0x4448),
+    PHY_W(0x1d, 0x4894),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c03),
+    PHY_W(0x1d, 0x4824),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c07),
+    PHY_W(0x1d, 0x41ef),
+    PHY_W(0x1d, 0x41ff),
+    PHY_W(0x1d, 0x4891),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c07),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c17),
+    PHY_W(0x1d, 0x8400),
+    PHY_W(0x1d, 0x8ef8),
+    PHY_W(0x1d, 0x41c7),
+    PHY_W(0x1d, 0x8f8d),
+    PHY_W(0x1d, 0x92d5),
+    PHY_W(0x1d, 0xa10f),
+    PHY_W(0x1d, 0xd480),
+    PHY_W(0x1d, 0x0008),
+    PHY_W(0x1d, 0xd580),
+    PHY_W(0x1d, 0x00b8),
+    PHY_W(0x1d, 0xa202),
+    PHY_W(0x1d, 0x3167),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x4404),
+    PHY_W(0x1d, 0x3167),
+    PHY_W(0x1d, 0xd484),
+    PHY_W(0x1d, 0x00f3),
+    PHY_W(0x1d, 0xd484),
+    PHY_W(0x1d, 0x00f1),
+    PHY_W(0x1d, 0x30f4),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ee0),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x5400),
+    PHY_W(0x1d, 0x4488),
+    PHY_W(0x1d, 0x41cf),
+    PHY_W(0x1d, 0x30f4),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4ec0),
+    PHY_W(0x1d, 0x48f3),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c09),
+    PHY_W(0x1d, 0x4508),
+    PHY_W(0x1d, 0x41c7),
+    PHY_W(0x1d, 0x8fb0),
+    PHY_W(0x1d, 0xd218),
+    PHY_W(0x1d, 0x00ae),
+    PHY_W(0x1d, 0xd2a4),
+    PHY_W(0x1d, 0x009e),
+    PHY_W(0x1d, 0x3188),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4e80),
+    PHY_W(0x1d, 0x4832),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c01),
+    PHY_W(0x1d, 0x7c1f),
+    PHY_W(0x1d, 0x4c11),
+    PHY_W(0x1d, 0x4428),
+    PHY_W(0x1d, 0x7c40),
+    PHY_W(0x1d, 0x5440),
+    PHY_W(0x1d, 0x7c01),
+    PHY_W(0x1d, 0x5801),
+    PHY_W(0x1d, 0x7c04),
+    PHY_W(0x1d, 0x5c04),
+    PHY_W(0x1d, 0x41e8),
+    PHY_W(0x1d, 0xa4b3),
+    PHY_W(0x1d, 0x319d),
+    PHY_W(0x1d, 0x7fe0),
+    PHY_W(0x1d, 0x4f20),
+    PHY_W(0x1d, 0x6800),
+    PHY_W(0x1d, 0x673e),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x0000),
+    PHY_W(0x1d, 0x570f),
+    PHY_W(0x1d, 0x5fff),
+    PHY_W(0x1d, 0xaa04),
+    PHY_W(0x1d, 0x585b),
+    PHY_W(0x1d, 0x6100),
+    PHY_W(0x1d, 0x31ad),
+    PHY_W(0x1d, 0x5867),
+    PHY_W(0x1d, 0x6080),
+    PHY_W(0x1d, 0xbcf2),
+    PHY_W(0x1d, 0x3001),
+    PHY_W(0x1f, 0x0004),
+    PHY_W(0x1c, 0x0200),
+    PHY_W(0x19, 0x7030),
+    PHY_W(0x1f, 0x0000),
+    PHY_END
+};
 
 static void
 rtl8101_set_phy_mcu_8106e_2(struct net_device *dev)
 {
     struct rtl8101_private *tp = netdev_priv(dev);
     
-    mdio_write(tp, 0x1F, 0x0000);
-    mdio_write(tp, 0x18, 0x0310);
-    
-    mdelay(20);
-    
-    mdio_write(tp, 0x1f, 0x0004);
-    mdio_write(tp, 0x1f, 0x0004);
-    mdio_write(tp, 0x19, 0x7070);
-    mdio_write(tp, 0x1c, 0x0600);
-    mdio_write(tp, 0x1d, 0x9700);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x4007);
-    mdio_write(tp, 0x1d, 0x4400);
-    mdio_write(tp, 0x1d, 0x4800);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x5310);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x673e);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x571f);
-    mdio_write(tp, 0x1d, 0x5ffb);
-    mdio_write(tp, 0x1d, 0xaa04);
-    mdio_write(tp, 0x1d, 0x5b58);
-    mdio_write(tp, 0x1d, 0x6100);
-    mdio_write(tp, 0x1d, 0x3016);
-    mdio_write(tp, 0x1d, 0x5b64);
-    mdio_write(tp, 0x1d, 0x6080);
-    mdio_write(tp, 0x1d, 0xa6fa);
-    mdio_write(tp, 0x1d, 0xdcdb);
-    mdio_write(tp, 0x1d, 0x0015);
-    mdio_write(tp, 0x1d, 0xb915);
-    mdio_write(tp, 0x1d, 0xb511);
-    mdio_write(tp, 0x1d, 0xd16b);
-    mdio_write(tp, 0x1d, 0x000f);
-    mdio_write(tp, 0x1d, 0xb40f);
-    mdio_write(tp, 0x1d, 0xd06b);
-    mdio_write(tp, 0x1d, 0x000d);
-    mdio_write(tp, 0x1d, 0xb206);
-    mdio_write(tp, 0x1d, 0x7c01);
-    mdio_write(tp, 0x1d, 0x5800);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x5c00);
-    mdio_write(tp, 0x1d, 0x3010);
-    mdio_write(tp, 0x1d, 0x7c01);
-    mdio_write(tp, 0x1d, 0x5801);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x5c04);
-    mdio_write(tp, 0x1d, 0x3016);
-    mdio_write(tp, 0x1d, 0x307e);
-    mdio_write(tp, 0x1d, 0x30f4);
-    mdio_write(tp, 0x1d, 0x319f);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4c60);
-    mdio_write(tp, 0x1d, 0x6803);
-    mdio_write(tp, 0x1d, 0x7d00);
-    mdio_write(tp, 0x1d, 0x6900);
-    mdio_write(tp, 0x1d, 0x6520);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0xaf03);
-    mdio_write(tp, 0x1d, 0x6115);
-    mdio_write(tp, 0x1d, 0x303a);
-    mdio_write(tp, 0x1d, 0x6097);
-    mdio_write(tp, 0x1d, 0x57e0);
-    mdio_write(tp, 0x1d, 0x580c);
-    mdio_write(tp, 0x1d, 0x588c);
-    mdio_write(tp, 0x1d, 0x5f80);
-    mdio_write(tp, 0x1d, 0x4827);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c10);
-    mdio_write(tp, 0x1d, 0x8400);
-    mdio_write(tp, 0x1d, 0x7c30);
-    mdio_write(tp, 0x1d, 0x6020);
-    mdio_write(tp, 0x1d, 0x48bf);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0xb802);
-    mdio_write(tp, 0x1d, 0x3053);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x6808);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7c10);
-    mdio_write(tp, 0x1d, 0x6810);
-    mdio_write(tp, 0x1d, 0xd6cf);
-    mdio_write(tp, 0x1d, 0x0002);
-    mdio_write(tp, 0x1d, 0x80fe);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4c80);
-    mdio_write(tp, 0x1d, 0x7c10);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7c23);
-    mdio_write(tp, 0x1d, 0x5c23);
-    mdio_write(tp, 0x1d, 0x481e);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c02);
-    mdio_write(tp, 0x1d, 0x5310);
-    mdio_write(tp, 0x1d, 0x81ff);
-    mdio_write(tp, 0x1d, 0x30c1);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4d00);
-    mdio_write(tp, 0x1d, 0x4832);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c10);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0xa4bd);
-    mdio_write(tp, 0x1d, 0xd9b3);
-    mdio_write(tp, 0x1d, 0x00fe);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4d20);
-    mdio_write(tp, 0x1d, 0x7e00);
-    mdio_write(tp, 0x1d, 0x6200);
-    mdio_write(tp, 0x1d, 0x3001);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4dc0);
-    mdio_write(tp, 0x1d, 0xd09d);
-    mdio_write(tp, 0x1d, 0x0002);
-    mdio_write(tp, 0x1d, 0xb4fe);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4d80);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x6004);
-    mdio_write(tp, 0x1d, 0x6802);
-    mdio_write(tp, 0x1d, 0x6728);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0x486c);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x9503);
-    mdio_write(tp, 0x1d, 0x7e00);
-    mdio_write(tp, 0x1d, 0x6200);
-    mdio_write(tp, 0x1d, 0x571f);
-    mdio_write(tp, 0x1d, 0x5fbb);
-    mdio_write(tp, 0x1d, 0xaa05);
-    mdio_write(tp, 0x1d, 0x5b58);
-    mdio_write(tp, 0x1d, 0x7d80);
-    mdio_write(tp, 0x1d, 0x6100);
-    mdio_write(tp, 0x1d, 0x309a);
-    mdio_write(tp, 0x1d, 0x5b64);
-    mdio_write(tp, 0x1d, 0x7d80);
-    mdio_write(tp, 0x1d, 0x6080);
-    mdio_write(tp, 0x1d, 0xcdab);
-    mdio_write(tp, 0x1d, 0x0058);
-    mdio_write(tp, 0x1d, 0xcd8d);
-    mdio_write(tp, 0x1d, 0x0056);
-    mdio_write(tp, 0x1d, 0xd96b);
-    mdio_write(tp, 0x1d, 0x0054);
-    mdio_write(tp, 0x1d, 0xd0a0);
-    mdio_write(tp, 0x1d, 0x00d8);
-    mdio_write(tp, 0x1d, 0xcba0);
-    mdio_write(tp, 0x1d, 0x0003);
-    mdio_write(tp, 0x1d, 0x80ec);
-    mdio_write(tp, 0x1d, 0x30a7);
-    mdio_write(tp, 0x1d, 0x30b4);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ce0);
-    mdio_write(tp, 0x1d, 0x4832);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c08);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x6008);
-    mdio_write(tp, 0x1d, 0x8300);
-    mdio_write(tp, 0x1d, 0xb902);
-    mdio_write(tp, 0x1d, 0x307e);
-    mdio_write(tp, 0x1d, 0x3068);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4da0);
-    mdio_write(tp, 0x1d, 0x6628);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x56a0);
-    mdio_write(tp, 0x1d, 0x590c);
-    mdio_write(tp, 0x1d, 0x5fa0);
-    mdio_write(tp, 0x1d, 0xcba4);
-    mdio_write(tp, 0x1d, 0x0004);
-    mdio_write(tp, 0x1d, 0xcd8d);
-    mdio_write(tp, 0x1d, 0x0002);
-    mdio_write(tp, 0x1d, 0x80fc);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ca0);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x6408);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7d00);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0xb603);
-    mdio_write(tp, 0x1d, 0x7c10);
-    mdio_write(tp, 0x1d, 0x6010);
-    mdio_write(tp, 0x1d, 0x7d1f);
-    mdio_write(tp, 0x1d, 0x551f);
-    mdio_write(tp, 0x1d, 0x5fb3);
-    mdio_write(tp, 0x1d, 0xaa05);
-    mdio_write(tp, 0x1d, 0x7c80);
-    mdio_write(tp, 0x1d, 0x5800);
-    mdio_write(tp, 0x1d, 0x5b58);
-    mdio_write(tp, 0x1d, 0x30d7);
-    mdio_write(tp, 0x1d, 0x7c80);
-    mdio_write(tp, 0x1d, 0x5800);
-    mdio_write(tp, 0x1d, 0x5b64);
-    mdio_write(tp, 0x1d, 0x4827);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c10);
-    mdio_write(tp, 0x1d, 0x8400);
-    mdio_write(tp, 0x1d, 0x7c10);
-    mdio_write(tp, 0x1d, 0x6000);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4cc0);
-    mdio_write(tp, 0x1d, 0x7d00);
-    mdio_write(tp, 0x1d, 0x6400);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x5fbb);
-    mdio_write(tp, 0x1d, 0x4824);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c00);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c04);
-    mdio_write(tp, 0x1d, 0x8200);
-    mdio_write(tp, 0x1d, 0x7ce0);
-    mdio_write(tp, 0x1d, 0x5400);
-    mdio_write(tp, 0x1d, 0x7d00);
-    mdio_write(tp, 0x1d, 0x6500);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x30a7);
-    mdio_write(tp, 0x1d, 0x3001);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e00);
-    mdio_write(tp, 0x1d, 0x4007);
-    mdio_write(tp, 0x1d, 0x4400);
-    mdio_write(tp, 0x1d, 0x5310);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x673e);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x570f);
-    mdio_write(tp, 0x1d, 0x5fff);
-    mdio_write(tp, 0x1d, 0xaa05);
-    mdio_write(tp, 0x1d, 0x585b);
-    mdio_write(tp, 0x1d, 0x7d80);
-    mdio_write(tp, 0x1d, 0x6100);
-    mdio_write(tp, 0x1d, 0x3107);
-    mdio_write(tp, 0x1d, 0x5867);
-    mdio_write(tp, 0x1d, 0x7d80);
-    mdio_write(tp, 0x1d, 0x6080);
-    mdio_write(tp, 0x1d, 0x9403);
-    mdio_write(tp, 0x1d, 0x7e00);
-    mdio_write(tp, 0x1d, 0x6200);
-    mdio_write(tp, 0x1d, 0xcda3);
-    mdio_write(tp, 0x1d, 0x00e8);
-    mdio_write(tp, 0x1d, 0xcd85);
-    mdio_write(tp, 0x1d, 0x00e6);
-    mdio_write(tp, 0x1d, 0xd96b);
-    mdio_write(tp, 0x1d, 0x00e4);
-    mdio_write(tp, 0x1d, 0x96e4);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x673e);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e20);
-    mdio_write(tp, 0x1d, 0x96dd);
-    mdio_write(tp, 0x1d, 0x8b04);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x5008);
-    mdio_write(tp, 0x1d, 0xab03);
-    mdio_write(tp, 0x1d, 0x7c08);
-    mdio_write(tp, 0x1d, 0x5000);
-    mdio_write(tp, 0x1d, 0x6801);
-    mdio_write(tp, 0x1d, 0x677e);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0xdb7c);
-    mdio_write(tp, 0x1d, 0x00ee);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x7fe1);
-    mdio_write(tp, 0x1d, 0x4e40);
-    mdio_write(tp, 0x1d, 0x4837);
-    mdio_write(tp, 0x1d, 0x4418);
-    mdio_write(tp, 0x1d, 0x41c7);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e40);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x5400);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x8fc2);
-    mdio_write(tp, 0x1d, 0xd2a0);
-    mdio_write(tp, 0x1d, 0x004b);
-    mdio_write(tp, 0x1d, 0x9204);
-    mdio_write(tp, 0x1d, 0xa042);
-    mdio_write(tp, 0x1d, 0x3132);
-    mdio_write(tp, 0x1d, 0x30f4);
-    mdio_write(tp, 0x1d, 0x7fe1);
-    mdio_write(tp, 0x1d, 0x4e60);
-    mdio_write(tp, 0x1d, 0x489c);
-    mdio_write(tp, 0x1d, 0x4628);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e60);
-    mdio_write(tp, 0x1d, 0x7e28);
-    mdio_write(tp, 0x1d, 0x4628);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x5400);
-    mdio_write(tp, 0x1d, 0x7c01);
-    mdio_write(tp, 0x1d, 0x5800);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x5c00);
-    mdio_write(tp, 0x1d, 0x41e8);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x8fa8);
-    mdio_write(tp, 0x1d, 0xb241);
-    mdio_write(tp, 0x1d, 0xa02a);
-    mdio_write(tp, 0x1d, 0x314c);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ea0);
-    mdio_write(tp, 0x1d, 0x7c02);
-    mdio_write(tp, 0x1d, 0x4402);
-    mdio_write(tp, 0x1d, 0x4448);
-    mdio_write(tp, 0x1d, 0x4894);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c03);
-    mdio_write(tp, 0x1d, 0x4824);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c07);
-    mdio_write(tp, 0x1d, 0x41ef);
-    mdio_write(tp, 0x1d, 0x41ff);
-    mdio_write(tp, 0x1d, 0x4891);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c07);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c17);
-    mdio_write(tp, 0x1d, 0x8400);
-    mdio_write(tp, 0x1d, 0x8ef8);
-    mdio_write(tp, 0x1d, 0x41c7);
-    mdio_write(tp, 0x1d, 0x8f8d);
-    mdio_write(tp, 0x1d, 0x92d5);
-    mdio_write(tp, 0x1d, 0xa10f);
-    mdio_write(tp, 0x1d, 0xd480);
-    mdio_write(tp, 0x1d, 0x0008);
-    mdio_write(tp, 0x1d, 0xd580);
-    mdio_write(tp, 0x1d, 0x00b8);
-    mdio_write(tp, 0x1d, 0xa202);
-    mdio_write(tp, 0x1d, 0x3167);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x4404);
-    mdio_write(tp, 0x1d, 0x3167);
-    mdio_write(tp, 0x1d, 0xd484);
-    mdio_write(tp, 0x1d, 0x00f3);
-    mdio_write(tp, 0x1d, 0xd484);
-    mdio_write(tp, 0x1d, 0x00f1);
-    mdio_write(tp, 0x1d, 0x30f4);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ee0);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x5400);
-    mdio_write(tp, 0x1d, 0x4488);
-    mdio_write(tp, 0x1d, 0x41cf);
-    mdio_write(tp, 0x1d, 0x30f4);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4ec0);
-    mdio_write(tp, 0x1d, 0x48f3);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c09);
-    mdio_write(tp, 0x1d, 0x4508);
-    mdio_write(tp, 0x1d, 0x41c7);
-    mdio_write(tp, 0x1d, 0x8fb0);
-    mdio_write(tp, 0x1d, 0xd218);
-    mdio_write(tp, 0x1d, 0x00ae);
-    mdio_write(tp, 0x1d, 0xd2a4);
-    mdio_write(tp, 0x1d, 0x009e);
-    mdio_write(tp, 0x1d, 0x3188);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4e80);
-    mdio_write(tp, 0x1d, 0x4832);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c01);
-    mdio_write(tp, 0x1d, 0x7c1f);
-    mdio_write(tp, 0x1d, 0x4c11);
-    mdio_write(tp, 0x1d, 0x4428);
-    mdio_write(tp, 0x1d, 0x7c40);
-    mdio_write(tp, 0x1d, 0x5440);
-    mdio_write(tp, 0x1d, 0x7c01);
-    mdio_write(tp, 0x1d, 0x5801);
-    mdio_write(tp, 0x1d, 0x7c04);
-    mdio_write(tp, 0x1d, 0x5c04);
-    mdio_write(tp, 0x1d, 0x41e8);
-    mdio_write(tp, 0x1d, 0xa4b3);
-    mdio_write(tp, 0x1d, 0x319d);
-    mdio_write(tp, 0x1d, 0x7fe0);
-    mdio_write(tp, 0x1d, 0x4f20);
-    mdio_write(tp, 0x1d, 0x6800);
-    mdio_write(tp, 0x1d, 0x673e);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x0000);
-    mdio_write(tp, 0x1d, 0x570f);
-    mdio_write(tp, 0x1d, 0x5fff);
-    mdio_write(tp, 0x1d, 0xaa04);
-    mdio_write(tp, 0x1d, 0x585b);
-    mdio_write(tp, 0x1d, 0x6100);
-    mdio_write(tp, 0x1d, 0x31ad);
-    mdio_write(tp, 0x1d, 0x5867);
-    mdio_write(tp, 0x1d, 0x6080);
-    mdio_write(tp, 0x1d, 0xbcf2);
-    mdio_write(tp, 0x1d, 0x3001);
-    mdio_write(tp, 0x1f, 0x0004);
-    mdio_write(tp, 0x1c, 0x0200);
-    mdio_write(tp, 0x19, 0x7030);
-    mdio_write(tp, 0x1f, 0x0000);
-}
+    rtl8101_run_phy_patch(tp, rtl8101_phy_mcu_8106e_2);
+}
+
+static const struct rtl8101_phy_patch_op rtl8101_phy_mcu_8106eus_1[] = {
+    PHY_W(0x1f, 0x0b82),
+    PHY_SET(0x10, BIT_4),
+    PHY_W(0x1f, 0x0b80),
+    PHY_POLL(0x10, 0x0040, 0x0040, 100),
+    PHY_W(0x1f, 0x0a43),
+    PHY_W(0x13, 0x8146),
+    PHY_W(0x14, 0x0300),
+    PHY_W(0x13, 0xb82e),
+    PHY_W(0x14, 0x0001),
+    PHY_W(0x1f, 0x0a43),
+    PHY_W(0x13, 0xb820),
+    PHY_W(0x14, 0x0290),
+    PHY_W(0x13, 0xa012),
+    PHY_W(0x14, 0x0000),
+    PHY_W(0x13, 0xa014),
+    PHY_W(0x14, 0x2c04),
+    PHY_W(0x14, 0x2c07),
+    PHY_W(0x14, 0x2c07),
+    PHY_W(0x14, 0x2c07),
+    PHY_W(0x14, 0xa304),
+    PHY_W(0x14, 0xa301),
+    PHY_W(0x14, 0x207e),
+    PHY_W(0x13, 0xa01a),
+    PHY_W(0x14, 0x0000),
+    PHY_W(0x13, 0xa006),
+    PHY_W(0x14, 0x0fff),
+    PHY_W(0x13, 0xa004),
+    PHY_W(0x14, 0x0fff),
+    PHY_W(0x13, 0xa002),
+    PHY_W(0x14, 0x0fff),
+    PHY_W(0x13, 0xa000),
+    PHY_W(0x14, 0x107c),
+    PHY_W(0x13, 0xb820),
+    PHY_W(0x14, 0x0210),
+    PHY_W(0x1f, 0x0a43),
+    PHY_W(0x13, 0x0000),
+    PHY_W(0x14, 0x0000),
+    PHY_W(0x1f, 0x0b82),
+    PHY_CLR(0x17, BIT_0),
+    PHY_W(0x1f, 0x0a43),
+    PHY_W(0x13, 0x8146),
+    PHY_W(0x14, 0x0000),
+    PHY_W(0x1f, 0x0b82),
+    PHY_CLR(0x10, BIT_4),
+    PHY_END
+};
 
 static void
 rtl8101_set_phy_mcu_8106eus_1(struct net_device *dev)
 {
     struct rtl8101_private *tp = netdev_priv(dev);
-    unsigned int gphy_val,i;
-    
-    mdio_write(tp, 0x1f, 0x0B82);
-    gphy_val = mdio_read(tp, 0x10);
-    gphy_val |= BIT_4;
-    mdio_write(tp, 0x10, gphy_val);
-    mdio_write(tp, 0x1f, 0x0B80);
-    i = 0;
-    do {
-        gphy_val = mdio_read(tp, 0x10);
-        gphy_val &= 0x0040;
-        udelay(50);
-        udelay(50);
-        i++;
-    } while(gphy_val != 0x0040 && i <1000);
-    mdio_write(tp, 0x1f, 0x0A43);
-    mdio_write(tp, 0x13, 0x8146);
-    mdio_write(tp, 0x14, 0x0300);
-    mdio_write(tp, 0x13, 0xB82E);
-    mdio_write(tp, 0x14, 0x0001);
-    mdio_write(tp, 0x1F, 0x0A43);
-    mdio_write(tp, 0x13, 0xb820);
-    mdio_write(tp, 0x14, 0x0290);
-    mdio_write(tp, 0x13, 0xa012);
-    mdio_write(tp, 0x14, 0x0000);
-    mdio_write(tp, 0x13, 0xa014);
-    mdio_write(tp, 0x14, 0x2c04);
-    mdio_write(tp, 0x14, 0x2c07);
-    mdio_write(tp, 0x14, 0x2c07);
-    mdio_write(tp, 0x14, 0x2c07);
-    mdio_write(tp, 0x14, 0xa304);
-    mdio_write(tp, 0x14, 0xa301);
-    mdio_write(tp, 0x14, 0x207e);
-    mdio_write(tp, 0x13, 0xa01a);
-    mdio_write(tp, 0x14, 0x0000);
-    mdio_write(tp, 0x13, 0xa006);
-    mdio_write(tp, 0x14, 0x0fff);
-    mdio_write(tp, 0x13, 0xa004);
-    mdio_write(tp, 0x14, 0x0fff);
-    mdio_write(tp, 0x13, 0xa002);
-    mdio_write(tp, 0x14, 0x0fff);
-    mdio_write(tp, 0x13, 0xa000);
-    mdio_write(tp, 0x14, 0x107c);
-    mdio_write(tp, 0x13, 0xb820);
-    mdio_write(tp, 0x14, 0x0210);
-    mdio_write(tp, 0x1F, 0x0A43);
-    mdio_write(tp, 0x13, 0x0000);
-    mdio_write(tp, 0x14, 0x0000);
-    mdio_write(tp, 0x1f, 0x0B82);
-    gphy_val = mdio_read(tp, 0x17);
-    gphy_val &= ~(BIT_0);
-    mdio_write(tp, 0x17, gphy_val);
-    mdio_write(tp, 0x1f, 0x0A43);
-    mdio_write(tp, 0x13, 0x8146);
-    mdio_write(tp, 0x14, 0x0000);
-    mdio_write(tp, 0x1f, 0x0B82);
-    gphy_val = mdio_read(tp, 0x10);
-    gphy_val &= ~(BIT_4);
-    mdio_write(tp, 0x10, gphy_val);
-}
+    
+    rtl8101_run_phy_patch(tp, rtl8101_phy_mcu_8106eus_1);
+}
+
+static const struct rtl8101_phy_patch_op rtl8101_phy_mcu_8107e_1[] = {
+    PHY_W(0x1f, 0x0b82),
+    PHY_SET(0x10, BIT_4),
+    PHY_W(0x1f, 0x0b80),
+    PHY_POLL(0x10, 0x0040, 0x0040, 100),
+    PHY_W(0x1f, 0x0a43),
+    PHY_W(0x13, 0x8028),
+    PHY_W(0x14, 0x6200),
+    PHY_W(0x13, 0xb82e),
+    PHY_W(0x14, 0x0001),
+    PHY_W(0x1f, 0x0a43),
+    PHY_W(0x13, 0xb820),
+    PHY_W(0x14, 0x0290),
+    PHY_W(0x13, 0xa012),
+    PHY_W(0x14, 0x0000),
+    PHY_W(0x13, 0xa014),
+    PHY_W(0x14, 0x2c04),
+    PHY_W(0x14, 0x2c10),
+    PHY_W(0x14, 0x2c10),
+    PHY_W(0x14, 0x2c10),
+    PHY_W(0x14, 0xa210),
+    PHY_W(0x14, 0xa101),
+    PHY_W(0x14, 0xce10),
+    PHY_W(0x14, 0xe070),
+    PHY_W(0x14, 0x0f40),
+    PHY_W(0x14, 0xaf01),
+    PHY_W(0x14, 0x8f01),
+    PHY_W(0x14, 0x183e),
+    PHY_W(0x14, 0x8e10),
+    PHY_W(0x14, 0x8101),
+    PHY_W(0x14, 0x8210),
+    PHY_W(0x14, 0x28da),
+    PHY_W(0x13, 0xa01a),
+    PHY_W(0x14, 0x0000),
+    PHY_W(0x13, 0xa006),
+    PHY_W(0x14, 0x0017),
+    PHY_W(0x13, 0xa004),
+    PHY_W(0x14, 0x0015),
+    PHY_W(0x13, 0xa002),
+    PHY_W(0x14, 0x0013),
+    PHY_W(0x13, 0xa000),
+    PHY_W(0x14, 0x18d1),
+    PHY_W(0x13, 0xb820),
+    PHY_W(0x14, 0x0210),
+    PHY_W(0x1f, 0x0a43),
+    PHY_W(0x13, 0x0000),
+    PHY_W(0x14, 0x0000),
+    PHY_W(0x1f, 0x0b82),
+    PHY_CLR(0x17, BIT_0),
+    PHY_W(0x1f, 0x0a43),
+    PHY_W(0x13, 0x8028),
+    PHY_W(0x14, 0x0000),
+    PHY_W(0x1f, 0x0b82),
+    PHY_CLR(0x10, BIT_4),
+    PHY_END
+};
 
 static void
 rtl8101_set_phy_mcu_8107e_1(struct net_device *dev)
 {
     struct rtl8101_private *tp = netdev_priv(dev);
-    unsigned int gphy_val,i;
     
-    mdio_write(tp, 0x1f, 0x0B82);
-    gphy_val = mdio_read(tp,  0x10);
-    gphy_val |= BIT_4;
-    mdio_write(tp, 0x10, gphy_val);
-    
-    mdio_write(tp, 0x1f, 0x0B80);
-    i = 0;
-    do {
-        gphy_val = mdio_read(tp,  0x10);
-        gphy_val &= 0x0040;
-        udelay(50);
-        udelay(50);
-        i++;
-    } while(gphy_val != 0x0040 && i <1000);
-    
-    mdio_write(tp, 0x1f, 0x0A43);
-    mdio_write(tp, 0x13, 0x8028);
-    mdio_write(tp, 0x14, 0x6200);
-    mdio_write(tp, 0x13, 0xB82E);
-    mdio_write(tp, 0x14, 0x0001);
-    
-    
-    mdio_write(tp, 0x1F, 0x0A43);
-    mdio_write(tp, 0x13, 0xB820);
-    mdio_write(tp, 0x14, 0x0290);
-    mdio_write(tp, 0x13, 0xA012);
-    mdio_write(tp, 0x14, 0x0000);
-    mdio_write(tp, 0x13, 0xA014);
-    mdio_write(tp, 0x14, 0x2c04);
-    mdio_write(tp, 0x14, 0x2c10);
-    mdio_write(tp, 0x14, 0x2c10);
-    mdio_write(tp, 0x14, 0x2c10);
-    mdio_write(tp, 0x14, 0xa210);
-    mdio_write(tp, 0x14, 0xa101);
-    mdio_write(tp, 0x14, 0xce10);
-    mdio_write(tp, 0x14, 0xe070);
-    mdio_write(tp, 0x14, 0x0f40);
-    mdio_write(tp, 0x14, 0xaf01);
-    mdio_write(tp, 0x14, 0x8f01);
-    mdio_write(tp, 0x14, 0x183e);
-    mdio_write(tp, 0x14, 0x8e10);
-    mdio_write(tp, 0x14, 0x8101);
-    mdio_write(tp, 0x14, 0x8210);
-    mdio_write(tp, 0x14, 0x28da);
-    mdio_write(tp, 0x13, 0xA01A);
-    mdio_write(tp, 0x14, 0x0000);
-    mdio_write(tp, 0x13, 0xA006);
-    mdio_write(tp, 0x14, 0x0017);
-    mdio_write(tp, 0x13, 0xA004);
-    mdio_write(tp, 0x14, 0x0015);
-    mdio_write(tp, 0x13, 0xA002);
-    mdio_write(tp, 0x14, 0x0013);
-    mdio_write(tp, 0x13, 0xA000);
-    mdio_write(tp, 0x14, 0x18d1);
-    mdio_write(tp, 0x13, 0xB820);
-    mdio_write(tp, 0x14, 0x0210);
-    
-    
-    mdio_write(tp, 0x1F, 0x0A43);
-    mdio_write(tp, 0x13, 0x0000);
-    mdio_write(tp, 0x14, 0x0000);
-    mdio_write(tp, 0x1f, 0x0B82);
-    gphy_val = mdio_read(tp,  0x17);
-    gphy_val &= ~(BIT_0);
-    mdio_write(tp, 0x17, gphy_val);
-    mdio_write(tp, 0x1f, 0x0A43);
-    mdio_write(tp, 0x13, 0x8028);
-    mdio_write(tp, 0x14, 0x0000);
-    
-    
-    mdio_write(tp, 0x1f, 0x0B82);
-    gphy_val = mdio_read(tp,  0x10);
-    gphy_val &= ~(BIT_4);
-    mdio_write(tp, 0x10, gphy_val);
-}
+    rtl8101_run_phy_patch(tp, rtl8101_phy_mcu_8107e_1);
+}
+
+static const struct rtl8101_phy_patch_op rtl8101_phy_mcu_8107e_2[] = {
+    PHY_W(0x1f, 0x0b82),
+    PHY_SET(0x10, BIT_4),
+    PHY_W(0x1f, 0x0b80),
+    PHY_POLL(0x10, 0x0040, 0x0040, 100),
+    PHY_W(0x1f, 0x0a43),
+    PHY_W(0x13, 0x8028),
+    PHY_W(0x14, 0x6201),
+    PHY_W(0x13, 0xb82e),
+    PHY_W(0x14, 0x0001),
+    PHY_W(0x1f, 0x0a43),
+    PHY_W(0x13, 0xb820),
+    PHY_W(0x14, 0x0290),
+    PHY_W(0x13, 0xa012),
+    PHY_W(0x14, 0x0000),
+    PHY_W(0x13, 0xa014),
+    PHY_W(0x14, 0x2c04),
+    PHY_W(0x14, 0x2c09),
+    PHY_W(0x14, 0x2c09),
+    PHY_W(0x14, 0x2c09),
+    PHY_W(0x14, 0xad01),
+    PHY_W(0x14, 0xad01),
+    PHY_W(0x14, 0xad01),
+    PHY_W(0x14, 0xad01),
+    PHY_W(0x14, 0x236c),
+    PHY_W(0x13, 0xa01a),
+    PHY_W(0x14, 0x0000),
+    PHY_W(0x13, 0xa006),
+    PHY_W(0x14, 0x0fff),
+    PHY_W(0x13, 0xa004),
+    PHY_W(0x14, 0x0fff),
+    PHY_W(0x13, 0xa002),
+    PHY_W(0x14, 0x0fff),
+    PHY_W(0x13, 0xa000),
+    PHY_W(0x14, 0x136b),
+    PHY_W(0x13, 0xb820),
+    PHY_W(0x14, 0x0210),
+    PHY_W(0x1f, 0x0a43),
+    PHY_W(0x13, 0x0000),
+    PHY_W(0x14, 0x0000),
+    PHY_W(0x1f, 0x0b82),
+    PHY_CLR(0x17, BIT_0),
+    PHY_W(0x1f, 0x0a43),
+    PHY_W(0x13, 0x8028),
+    PHY_W(0x14, 0x0000),
+    PHY_W(0x1f, 0x0b82),
+    PHY_CLR(0x10, BIT_4),
+    PHY_END
+};
 
 static void
 rtl8101_set_phy_mcu_8107e_2(struct net_device *dev)
 {
     struct rtl8101_private *tp = netdev_priv(dev);
-    unsigned int gphy_val,i;
+    unsigned int gphy_val;
     
-    mdio_write(tp, 0x1f, 0x0B82);
-    gphy_val = mdio_read(tp, 0x10);
-    gphy_val |= BIT_4;
-    mdio_write(tp, 0x10, gphy_val);
-    
-    mdio_write(tp, 0x1f, 0x0B80);
-    i = 0;
-    do {
-        gphy_val = mdio_read(tp, 0x10);
-        gphy_val &= 0x0040;
-        udelay(50);
-        udelay(50);
-        i++;
-    } while(gphy_val != 0x0040 && i <1000);
-    
-    mdio_write(tp, 0x1f, 0x0A43);
-    mdio_write(tp, 0x13, 0x8028);
-    mdio_write(tp, 0x14, 0x6201);
-    mdio_write(tp, 0x13, 0xB82E);
-    mdio_write(tp, 0x14, 0x0001);
-    
-    
-    mdio_write(tp, 0x1F, 0x0A43);
-    mdio_write(tp, 0x13, 0xB820);
-    mdio_write(tp, 0x14, 0x0290);
-    mdio_write(tp, 0x13, 0xA012);
-    mdio_write(tp, 0x14, 0x0000);
-    mdio_write(tp, 0x13, 0xA014);
-    mdio_write(tp, 0x14, 0x2c04);
-    mdio_write(tp, 0x14, 0x2c09);
-    mdio_write(tp, 0x14, 0x2c09);
-    mdio_write(tp, 0x14, 0x2c09);
-    mdio_write(tp, 0x14, 0xad01);
-    mdio_write(tp, 0x14, 0xad01);
-    mdio_write(tp, 0x14, 0xad01);
-    mdio_write(tp, 0x14, 0xad01);
-    mdio_write(tp, 0x14, 0x236c);
-    mdio_write(tp, 0x13, 0xA01A);
-    mdio_write(tp, 0x14, 0x0000);
-    mdio_write(tp, 0x13, 0xA006);
-    mdio_write(tp, 0x14, 0x0fff);
-    mdio_write(tp, 0x13, 0xA004);
-    mdio_write(tp, 0x14, 0x0fff);
-    mdio_write(tp, 0x13, 0xA002);
-    mdio_write(tp, 0x14, 0x0fff);
-    mdio_write(tp, 0x13, 0xA000);
-    mdio_write(tp, 0x14, 0x136b);
-    mdio_write(tp, 0x13, 0xB820);
-    mdio_write(tp, 0x14, 0x0210);
-    
-    
-    mdio_write(tp,0x1F, 0x0A43);
-    mdio_write(tp,0x13, 0x0000);
-    mdio_write(tp,0x14, 0x0000);
-    mdio_write(tp,0x1f, 0x0B82);
-    gphy_val = mdio_read(tp, 0x17);
-    gphy_val &= ~(BIT_0);
-    mdio_write(tp,0x17, gphy_val);
-    mdio_write(tp,0x1f, 0x0A43);
-    mdio_write(tp,0x13, 0x8028);
-    mdio_write(tp,0x14, 0x0000);
-    
-    
-    mdio_write(tp, 0x1f, 0x0B82);
-    gphy_val = mdio_read(tp, 0x10);
-    gphy_val &= ~(BIT_4);
-    mdio_write(tp, 0x10, gphy_val);
+    rtl8101_run_phy_patch(tp, rtl8101_phy_mcu_8107e_2);
     
     if (tp->RequiredSecLanDonglePatch) {
         mdio_write(tp, 0x1F, 0x0A43);
@@ -8245,8 +8318,15 @@ rtl8101_init_hw_phy_mcu(struct net_device *dev)
 {
     struct rtl8101_private *tp = netdev_priv(dev);
     
+    u64 start, end;
+    
     if (tp->NotWrRamCodeToMicroP == TRUE) return;
-    if(rtl8101_check_hw_phy_mcu_code_ver(dev)) return;
+    if(rtl8101_check_hw_phy_mcu_code_ver(dev)) {
+        tp->phy_mcu_skip_count++;
+        tp->phy_mcu_time_saved += tp->phy_mcu_load_time;
+        return;
+    }
+    clock_get_uptime(&start);
     
     switch (tp->mcfg) {
         case CFG_METHOD_10:
@@ -8279,6 +8359,10 @@ rtl8101_init_hw_phy_mcu(struct net_device *dev)
     mdio_write(tp, 0x1F, 0x0000);
     
     tp->HwHasWrRamCodeToMicroP = TRUE;
+    
+    clock_get_uptime(&end);
+    absolutetime_to_nanoseconds(end - start, &tp->phy_mcu_load_time);
+    tp->phy_mcu_load_count++;
 }
 
 void
@@ -1360,6 +1360,11 @@ struct rtl8101_private {
     u16 sw_ram_code_ver;
     u16 hw_ram_code_ver;
     
+    u32 phy_mcu_load_count;
+    u32 phy_mcu_skip_count;
+    u64 phy_mcu_load_time;      /* duration of the last download in ns */
+    u64 phy_mcu_time_saved;     /* accumulated time of skipped downloads in ns */
+    
     u8 rtk_enable_diag;
     
     u8 RequireAdcBiasPatch;
@@ -1443,6 +1448,27 @@ enum mcfg {
 #define HW_PATCH_SOC_LAN (BIT_0)
 #define HW_PATCH_SAMSUNG_LAN_DONGLE (BIT_2)
 
+//Register access completion polling
+#define RTL_POLL_TIMEOUT        1000    /* µs */
+#define RTL_POLL_MAX_STEP       64      /* µs */
+#define RTL_ACCESS_HIST_BUCKETS 12      /* log2 buckets of the completion time in µs */
+
+enum rtl8101_access_type {
+    RTL_ACCESS_MDIO = 0,
+    RTL_ACCESS_EPHY,
+    RTL_ACCESS_ERI,
+    RTL_ACCESS_PHYIO,
+    RTL_ACCESS_COUNT
+};
+
+/* Shared by all instances and updated with OSIncrementAtomic(). */
+struct rtl8101_access_stats {
+    SInt32 hist[RTL_ACCESS_HIST_BUCKETS];
+    SInt32 timeouts;
+};
+
+extern struct rtl8101_access_stats rtl8101_access_stats[RTL_ACCESS_COUNT];
+
 void mdio_write(struct rtl8101_private *tp, u32 RegAddr, u32 value);
 void mdio_prot_write(struct rtl8101_private *tp, u32 RegAddr, u32 value);
 u32 mdio_read(struct rtl8101_private *tp, u32 RegAddr);